@@ -45,8 +45,20 @@
 
 #define FLAG_DEBUG 0x1000
 
+// CIRCUITPY-CHANGE
+#define RE_LITERAL_MAX (14)
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    // CIRCUITPY-CHANGE: a literal every match contains, and whether every
+    // match starts with it
+    #if MICROPY_OPT_RE_PIKEVM
+    uint8_t lit_len;
+    bool lit_is_prefix;
+    char lit[RE_LITERAL_MAX];
+    // memory for the Pike VM, allocated the first time it is needed
+    void *pikevm_mem;
+    #endif
     ByteProg re;
 } mp_obj_re_t;
 
@@ -194,13 +206,138 @@ static void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
     mp_printf(print, "<re %p>", self);
 }
 
+// CIRCUITPY-CHANGE: run the compiled program, with a linear time bound if enabled
+#if MICROPY_OPT_RE_PIKEVM
+
+static const char *re_find_literal(const char *s, const char *end, const char *lit, size_t lit_len) {
+    while ((size_t)(end - s) >= lit_len) {
+        s = memchr(s, (unsigned char)lit[0], end - s - lit_len + 1);
+        if (s == NULL) {
+            break;
+        }
+        if (memcmp(s + 1, lit + 1, lit_len - 1) == 0) {
+            return s;
+        }
+        s++;
+    }
+    return NULL;
+}
+
+// Stack assumed to be used by each level of the backtracking matcher. This is
+// an overestimate, so the Pike VM takes over before the stack check fails.
+#define RE_BACKTRACK_FRAME_SIZE (16 * sizeof(void *))
+
+static int re_backtrack_max_depth(void) {
+    #if MICROPY_STACK_CHECK && !MICROPY_ENABLE_DYNRUNTIME
+    mp_uint_t usage = mp_stack_usage();
+    mp_uint_t limit = MP_STATE_THREAD(stack_limit);
+    if (usage >= limit) {
+        return 0;
+    }
+    mp_uint_t depth = (limit - usage) / RE_BACKTRACK_FRAME_SIZE;
+    return depth < INT_MAX ? (int)depth : INT_MAX;
+    #else
+    return INT_MAX;
+    #endif
+}
+
+static int re_exec_prog(mp_obj_re_t *self, const Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    Subject s = *subj;
+    if (self->lit_len > 0) {
+        if (self->lit_is_prefix && is_anchored) {
+            if ((size_t)(s.end - s.begin) < self->lit_len || memcmp(s.begin, self->lit, self->lit_len) != 0) {
+                return 0;
+            }
+        } else if (!is_anchored) {
+            const char *lit = re_find_literal(s.begin, s.end, self->lit, self->lit_len);
+            if (lit == NULL) {
+                return 0;
+            }
+            if (self->lit_is_prefix) {
+                // No match can start before the literal.
+                s.begin = lit;
+            }
+        }
+    }
+
+    // Backtracking is fastest for most patterns, but is exponential in the
+    // worst case, so it gets a number of steps proportional to the Pike VM's
+    // worst case before the Pike VM takes over. It recurses once for each
+    // repetition, so it may also run out of stack on long subjects.
+    size_t steps = (size_t)self->re.len * (s.end - s.begin + 1);
+    int res = re1_5_recursiveloopprog_bounded(&self->re, &s, caps, caps_num, is_anchored,
+        steps < INT_MAX ? (int)steps : INT_MAX, re_backtrack_max_depth());
+    if (res >= 0) {
+        return res;
+    }
+    // cast is a workaround for a bug in msvc (see re_exec)
+    memset((char **)caps, 0, caps_num * sizeof(char *));
+    // caps_num is the same for every call, so the memory is kept for reuse.
+    // It is taken from the object while in use, in case of an exception.
+    void *mem = self->pikevm_mem;
+    self->pikevm_mem = NULL;
+    if (mem == NULL) {
+        mem = m_new(char, re1_5_pikevm_memsize(&self->re, caps_num));
+    }
+    res = re1_5_pikevm(&self->re, &s, caps, caps_num, is_anchored, mem);
+    self->pikevm_mem = mem;
+    return res;
+}
+
+#else
+
+static int re_exec_prog(mp_obj_re_t *self, const Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    return re1_5_recursiveloopprog(&self->re, (Subject *)subj, caps, caps_num, is_anchored);
+}
+
+#endif
+
+// CIRCUITPY-CHANGE: remember recently compiled patterns for the module-level
+// functions, most recently used first
+#if MICROPY_PY_RE_CACHE_SIZE > 0 && !MICROPY_ENABLE_DYNRUNTIME
+
+static mp_obj_re_t *re_compile_cached(mp_obj_t pattern) {
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    const mp_obj_type_t *type = mp_obj_get_type(pattern);
+    mp_obj_t re;
+    size_t i;
+    for (i = 0; i < MICROPY_PY_RE_CACHE_SIZE && cache[i * 2] != MP_OBJ_NULL; i++) {
+        if (cache[i * 2] == pattern
+            || (mp_obj_get_type(cache[i * 2]) == type && mp_obj_equal(cache[i * 2], pattern))) {
+            re = cache[i * 2 + 1];
+            goto found;
+        }
+    }
+    re = mod_re_compile(1, &pattern);
+    if (i == MICROPY_PY_RE_CACHE_SIZE) {
+        // Evict the least recently used pattern.
+        i--;
+    }
+found:
+    memmove(cache + 2, cache, i * 2 * sizeof(mp_obj_t));
+    cache[0] = pattern;
+    cache[1] = re;
+    return MP_OBJ_TO_PTR(re);
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t re_cache[MICROPY_PY_RE_CACHE_SIZE * 2]);
+
+#else
+
+static mp_obj_re_t *re_compile_cached(mp_obj_t pattern) {
+    return MP_OBJ_TO_PTR(mod_re_compile(1, &pattern));
+}
+
+#endif
+
 static mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
     mp_obj_re_t *self;
     if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
         self = MP_OBJ_TO_PTR(args[0]);
     } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
+        // CIRCUITPY-CHANGE
+        self = re_compile_cached(args[0]);
     }
     Subject subj;
     size_t len;
@@ -241,7 +378,8 @@ static mp_obj_t re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, caps, char *, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char *)match->caps, 0, caps_num * sizeof(char *));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    // CIRCUITPY-CHANGE
+    int res = re_exec_prog(self, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, caps, char *, caps_num, match);
         return mp_const_none;
@@ -282,7 +420,8 @@ static mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char **)caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        // CIRCUITPY-CHANGE
+        int res = re_exec_prog(self, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -315,7 +454,8 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     if (mp_obj_is_type(args[0], (mp_obj_type_t *)&re_type)) {
         self = MP_OBJ_TO_PTR(args[0]);
     } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
+        // CIRCUITPY-CHANGE
+        self = re_compile_cached(args[0]);
     }
     mp_obj_t replace = args[1];
     mp_obj_t where = args[2];
@@ -342,7 +482,8 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char *)match->caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        // CIRCUITPY-CHANGE
+        int res = re_exec_prog(self, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -476,6 +617,11 @@ static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
         re1_5_dumpcode(&o->re);
     }
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_RE_PIKEVM
+    o->lit_len = re1_5_literal(&o->re, o->lit, RE_LITERAL_MAX, &o->lit_is_prefix);
+    o->pikevm_mem = NULL;
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
@@ -511,6 +657,11 @@ MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
 
 #include "lib/re1.5/compilecode.c"
 #include "lib/re1.5/recursiveloop.c"
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_RE_PIKEVM
+#include "lib/re1.5/pikevm.c"
+#include "lib/re1.5/literal.c"
+#endif
 #include "lib/re1.5/charclass.c"
 
 #if MICROPY_PY_RE_DEBUG
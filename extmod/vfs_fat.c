@@ -82,6 +82,10 @@ static mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_
     // create new object
     fs_user_mount_t *vfs = mp_obj_malloc(fs_user_mount_t, type);
     vfs->fatfs.drv = vfs;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    vfs->block_cache = NULL;
+    #endif
 
     // Initialise underlying block device
     vfs->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
@@ -443,7 +447,16 @@ static mp_obj_t vfs_fat_mount(mp_obj_t self_in, mp_obj_t readonly, mp_obj_t mkfs
 static MP_DEFINE_CONST_FUN_OBJ_3(vfs_fat_mount_obj, vfs_fat_mount);
 
 static mp_obj_t vfs_fat_umount(mp_obj_t self_in) {
+    // CIRCUITPY-CHANGE: The block device may be removed or mounted elsewhere next, so write
+    // back any cached sectors.
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!fat_vfs_block_cache_flush(self)) {
+        mp_raise_OSError(MP_EIO);
+    }
+    #else
     (void)self_in;
+    #endif
     // keep the FAT filesystem mounted internally so the VFS methods can still be used
     return mp_const_none;
 }
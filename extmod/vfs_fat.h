@@ -30,6 +30,27 @@
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs.h"
 
+// CIRCUITPY-CHANGE: Number of sectors kept in a write-back cache between FatFs and
+// native block devices. FatFs itself only has a single sector window per volume.
+#ifndef MICROPY_FATFS_BLOCK_CACHE_SECTORS
+#define MICROPY_FATFS_BLOCK_CACHE_SECTORS (0)
+#endif
+
+#if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 32
+#error "MICROPY_FATFS_BLOCK_CACHE_SECTORS must be 32 or less"
+#endif
+
+#if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+typedef struct _fs_block_cache_t {
+    uint32_t valid;  // bitmask of entries holding a sector
+    uint32_t dirty;  // bitmask of entries not yet written to the block device
+    uint32_t clock;  // incremented on each access, for LRU replacement
+    uint32_t sector[MICROPY_FATFS_BLOCK_CACHE_SECTORS];
+    uint32_t last_used[MICROPY_FATFS_BLOCK_CACHE_SECTORS];
+    uint8_t data[MICROPY_FATFS_BLOCK_CACHE_SECTORS][FF_MAX_SS];
+} fs_block_cache_t;
+#endif
+
 typedef struct _fs_user_mount_t {
     mp_obj_base_t base;
     mp_vfs_blockdev_t blockdev;
@@ -38,6 +59,12 @@ typedef struct _fs_user_mount_t {
     // CIRCUITPY-CHANGE: Count the users that are manipulating the blockdev via
     // native fatfs so we can lock and unlock the blockdev.
     int8_t lock_count;
+
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    // Cache storage provided by the owner of a native block device, or NULL to
+    // pass every access straight through.
+    fs_block_cache_t *block_cache;
+    #endif
 } fs_user_mount_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -47,6 +74,10 @@ extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
 MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 
+// CIRCUITPY-CHANGE: Write any dirty sectors in the block cache to the block device.
+// Returns false on a write error.
+bool fat_vfs_block_cache_flush(fs_user_mount_t *vfs);
+
 // CIRCUITPY-CHANGE
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "py/mphal.h"
 
@@ -48,6 +49,100 @@ static fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t *)bdev;
 }
 
+// CIRCUITPY-CHANGE: LRU write-back cache of single sectors, so that FAT and directory
+// accesses don't keep evicting each other and file data from the FatFs window.
+#if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+
+// Only native block devices that have been given a cache are cached. Python block
+// devices may do their own caching and expect to see each write as it happens.
+static bool block_cache_enabled(fs_user_mount_t *vfs) {
+    return vfs->block_cache != NULL &&
+           (vfs->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) != 0 &&
+           vfs->blockdev.block_size <= FF_MAX_SS;
+}
+
+static int block_cache_find(fs_block_cache_t *cache, DWORD sector) {
+    for (size_t i = 0; i < MICROPY_FATFS_BLOCK_CACHE_SECTORS; i++) {
+        if ((cache->valid & (1U << i)) && cache->sector[i] == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void block_cache_touch(fs_block_cache_t *cache, size_t i) {
+    cache->last_used[i] = ++cache->clock;
+}
+
+static int block_cache_write_back(fs_user_mount_t *vfs, size_t i) {
+    fs_block_cache_t *cache = vfs->block_cache;
+    if ((cache->dirty & (1U << i)) == 0) {
+        return 0;
+    }
+    int ret = mp_vfs_blockdev_write(&vfs->blockdev, cache->sector[i], 1, cache->data[i]);
+    if (ret == 0) {
+        cache->dirty &= ~(1U << i);
+    }
+    return ret;
+}
+
+// Returns a free entry, writing back and evicting the least recently used one if needed.
+// Returns -1 if the evicted entry could not be written back.
+static int block_cache_alloc(fs_user_mount_t *vfs, DWORD sector) {
+    fs_block_cache_t *cache = vfs->block_cache;
+    size_t victim = 0;
+    uint32_t oldest_age = 0;
+    for (size_t i = 0; i < MICROPY_FATFS_BLOCK_CACHE_SECTORS; i++) {
+        if ((cache->valid & (1U << i)) == 0) {
+            victim = i;
+            break;
+        }
+        uint32_t age = cache->clock - cache->last_used[i];
+        if (age >= oldest_age) {
+            oldest_age = age;
+            victim = i;
+        }
+    }
+    if (block_cache_write_back(vfs, victim) != 0) {
+        return -1;
+    }
+    cache->valid |= 1U << victim;
+    cache->sector[victim] = sector;
+    return victim;
+}
+
+// Drop all entries in [sector, sector + count) without writing them back.
+static void block_cache_discard(fs_block_cache_t *cache, DWORD sector, UINT count) {
+    for (size_t i = 0; i < MICROPY_FATFS_BLOCK_CACHE_SECTORS; i++) {
+        if ((cache->valid & (1U << i)) && cache->sector[i] - sector < count) {
+            cache->valid &= ~(1U << i);
+            cache->dirty &= ~(1U << i);
+        }
+    }
+}
+
+bool fat_vfs_block_cache_flush(fs_user_mount_t *vfs) {
+    if (vfs->block_cache == NULL) {
+        return true;
+    }
+    bool ok = true;
+    for (size_t i = 0; i < MICROPY_FATFS_BLOCK_CACHE_SECTORS; i++) {
+        if (block_cache_write_back(vfs, i) != 0) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+#else
+
+bool fat_vfs_block_cache_flush(fs_user_mount_t *vfs) {
+    (void)vfs;
+    return true;
+}
+
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
@@ -63,6 +158,43 @@ DRESULT disk_read(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    if (block_cache_enabled(vfs)) {
+        fs_block_cache_t *cache = vfs->block_cache;
+        size_t block_size = vfs->blockdev.block_size;
+        if (count == 1) {
+            int i = block_cache_find(cache, sector);
+            if (i < 0) {
+                if (mp_vfs_blockdev_read(&vfs->blockdev, sector, 1, buff) != 0) {
+                    return RES_ERROR;
+                }
+                i = block_cache_alloc(vfs, sector);
+                if (i < 0) {
+                    // Couldn't make room, but the read itself succeeded.
+                    return RES_OK;
+                }
+                memcpy(cache->data[i], buff, block_size);
+            } else {
+                memcpy(buff, cache->data[i], block_size);
+            }
+            block_cache_touch(cache, i);
+            return RES_OK;
+        }
+        // Multi-sector reads are file data, so read them straight through without
+        // filling the cache. Cached sectors may be newer than the block device.
+        if (mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff) != 0) {
+            return RES_ERROR;
+        }
+        for (size_t i = 0; i < MICROPY_FATFS_BLOCK_CACHE_SECTORS; i++) {
+            if ((cache->valid & (1U << i)) && cache->sector[i] - sector < count) {
+                memcpy(buff + (cache->sector[i] - sector) * block_size, cache->data[i], block_size);
+            }
+        }
+        return RES_OK;
+    }
+    #endif
+
     int ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
 
     return ret == 0 ? RES_OK : RES_ERROR;
@@ -83,6 +215,30 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    if (block_cache_enabled(vfs) && vfs->blockdev.writeblocks[0] != MP_OBJ_NULL) {
+        fs_block_cache_t *cache = vfs->block_cache;
+        if (count == 1) {
+            // Single sectors are FAT, directory or partial file updates, which are
+            // likely to be written again soon. Hold them until evicted or synced.
+            int i = block_cache_find(cache, sector);
+            if (i < 0) {
+                i = block_cache_alloc(vfs, sector);
+                if (i < 0) {
+                    return RES_ERROR;
+                }
+            }
+            memcpy(cache->data[i], buff, vfs->blockdev.block_size);
+            cache->dirty |= 1U << i;
+            block_cache_touch(cache, i);
+            return RES_OK;
+        }
+        // Larger writes go straight through and replace any cached copies.
+        block_cache_discard(cache, sector, count);
+    }
+    #endif
+
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
     if (ret == -MP_EROFS) {
@@ -116,6 +272,21 @@ DRESULT disk_ioctl(
         [IOCTL_INIT] = MP_BLOCKDEV_IOCTL_INIT,
     };
     uint8_t bp_op = op_map[cmd & 7];
+
+    // CIRCUITPY-CHANGE: Make sure cached sectors reach the block device before it is synced.
+    // A (re)initialisation means a fresh mount or mkfs, so start with an empty cache.
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    if (vfs->block_cache != NULL && (cmd == CTRL_SYNC || cmd == IOCTL_INIT)) {
+        bool flushed = fat_vfs_block_cache_flush(vfs);
+        if (cmd == IOCTL_INIT) {
+            vfs->block_cache->valid = 0;
+            vfs->block_cache->dirty = 0;
+        } else if (!flushed) {
+            return RES_ERROR;
+        }
+    }
+    #endif
+
     mp_obj_t ret = mp_const_none;
     if (bp_op != 0) {
         ret = mp_vfs_blockdev_ioctl(&vfs->blockdev, bp_op, 0);
@@ -118,6 +118,10 @@ static mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
         s->offset = f_tell(&self->fp);
         return 0;
 
+    // CIRCUITPY-CHANGE
+    } else if (request == MP_STREAM_GET_FILESIZE) {
+        return f_size(&self->fp);
+
     } else if (request == MP_STREAM_FLUSH) {
         FRESULT res = f_sync(&self->fp);
         if (res != FR_OK) {
@@ -166,6 +170,8 @@ static const mp_stream_p_t vfs_fat_fileio_stream_p = {
     .read = file_obj_read,
     .write = file_obj_write,
     .ioctl = file_obj_ioctl,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -182,6 +188,8 @@ static const mp_stream_p_t vfs_fat_textio_stream_p = {
     .write = file_obj_write,
     .ioctl = file_obj_ioctl,
     .is_text = true,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -33,7 +33,8 @@
 #include "extmod/vfs.h"
 #include "extmod/vfs_lfs.h"
 
-enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime };
+// CIRCUITPY-CHANGE: cachesize and readahead
+enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime, LFS_MAKE_ARG_cachesize, LFS_MAKE_ARG_readahead };
 
 static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
@@ -41,8 +42,27 @@ static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_progsize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_lookahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_mtime, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    { MP_QSTR_cachesize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    { MP_QSTR_readahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
 };
 
+// CIRCUITPY-CHANGE: Window of a block read ahead of small littlefs reads, so that
+// sequential reads of a file or metadata don't each go to the block device.
+typedef struct _mp_vfs_lfs_readahead_t {
+    uint8_t *buf;
+    uint32_t size; // 0 if readahead is disabled
+    uint32_t block;
+    uint32_t off;
+    uint32_t len; // 0 if buf holds no valid data
+} mp_vfs_lfs_readahead_t;
+
+// CIRCUITPY-CHANGE: Counts of block device operations, returned by VfsLfsx.stats().
+typedef struct _mp_vfs_lfs_stats_t {
+    uint32_t reads;
+    uint32_t progs;
+    uint32_t erases;
+} mp_vfs_lfs_stats_t;
+
 #if MICROPY_VFS_LFS1
 
 #include "lib/littlefs/lfs1.h"
@@ -62,6 +82,9 @@ typedef struct _mp_obj_vfs_lfs1_t {
     vstr_t cur_dir;
     struct lfs1_config config;
     lfs1_t lfs;
+    // CIRCUITPY-CHANGE
+    mp_vfs_lfs_readahead_t readahead;
+    mp_vfs_lfs_stats_t stats;
 } mp_obj_vfs_lfs1_t;
 
 typedef struct _mp_obj_vfs_lfs1_file_t {
@@ -112,6 +135,9 @@ typedef struct _mp_obj_vfs_lfs2_t {
     vstr_t cur_dir;
     struct lfs2_config config;
     lfs2_t lfs;
+    // CIRCUITPY-CHANGE
+    mp_vfs_lfs_readahead_t readahead;
+    mp_vfs_lfs_stats_t stats;
 } mp_obj_vfs_lfs2_t;
 
 typedef struct _mp_obj_vfs_lfs2_file_t {
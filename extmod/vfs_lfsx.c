@@ -43,8 +43,13 @@
 #error "MICROPY_VFS_LFS requires MICROPY_ENABLE_FINALISER"
 #endif
 
+// CIRCUITPY-CHANGE: The config context is the VFS object, for readahead and stats.
+static inline MP_OBJ_VFS_LFSx *MP_VFS_LFSx(from_config)(const struct LFSx_API (config) * c) {
+    return (MP_OBJ_VFS_LFSx *)c->context;
+}
+
 static int MP_VFS_LFSx(dev_ioctl)(const struct LFSx_API (config) * c, int cmd, int arg, bool must_return_int) {
-    mp_obj_t ret = mp_vfs_blockdev_ioctl(c->context, cmd, arg);
+    mp_obj_t ret = mp_vfs_blockdev_ioctl(&MP_VFS_LFSx(from_config)(c)->blockdev, cmd, arg);
     int ret_i = 0;
     if (must_return_int || ret != mp_const_none) {
         ret_i = mp_obj_get_int(ret);
@@ -53,14 +58,51 @@ static int MP_VFS_LFSx(dev_ioctl)(const struct LFSx_API (config) * c, int cmd, i
 }
 
 static int MP_VFS_LFSx(dev_read)(const struct LFSx_API (config) * c, LFSx_API(block_t) block, LFSx_API(off_t) off, void *buffer, LFSx_API(size_t) size) {
-    return mp_vfs_blockdev_read_ext(c->context, block, off, size, buffer);
+    MP_OBJ_VFS_LFSx *self = MP_VFS_LFSx(from_config)(c);
+    // CIRCUITPY-CHANGE: Serve small reads from the readahead window, refilling it on a miss.
+    mp_vfs_lfs_readahead_t *ra = &self->readahead;
+    if (size < ra->size) {
+        if (ra->len == 0 || block != ra->block || off < ra->off || off + size > ra->off + ra->len) {
+            uint32_t len = MIN(ra->size, c->block_size - off);
+            if (len <= size) {
+                // Too close to the end of the block to be worth reading ahead.
+                self->stats.reads++;
+                return mp_vfs_blockdev_read_ext(&self->blockdev, block, off, size, buffer);
+            }
+            ra->len = 0;
+            self->stats.reads++;
+            int ret = mp_vfs_blockdev_read_ext(&self->blockdev, block, off, len, ra->buf);
+            if (ret != 0) {
+                return ret;
+            }
+            ra->block = block;
+            ra->off = off;
+            ra->len = len;
+        }
+        memcpy(buffer, ra->buf + (off - ra->off), size);
+        return 0;
+    }
+    self->stats.reads++;
+    return mp_vfs_blockdev_read_ext(&self->blockdev, block, off, size, buffer);
 }
 
 static int MP_VFS_LFSx(dev_prog)(const struct LFSx_API (config) * c, LFSx_API(block_t) block, LFSx_API(off_t) off, const void *buffer, LFSx_API(size_t) size) {
-    return mp_vfs_blockdev_write_ext(c->context, block, off, size, buffer);
+    MP_OBJ_VFS_LFSx *self = MP_VFS_LFSx(from_config)(c);
+    // CIRCUITPY-CHANGE
+    if (block == self->readahead.block) {
+        self->readahead.len = 0;
+    }
+    self->stats.progs++;
+    return mp_vfs_blockdev_write_ext(&self->blockdev, block, off, size, buffer);
 }
 
 static int MP_VFS_LFSx(dev_erase)(const struct LFSx_API (config) * c, LFSx_API(block_t) block) {
+    MP_OBJ_VFS_LFSx *self = MP_VFS_LFSx(from_config)(c);
+    // CIRCUITPY-CHANGE
+    if (block == self->readahead.block) {
+        self->readahead.len = 0;
+    }
+    self->stats.erases++;
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_BLOCK_ERASE, block, true);
 }
 
@@ -68,14 +110,18 @@ static int MP_VFS_LFSx(dev_sync)(const struct LFSx_API (config) * c) {
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_SYNC, 0, false);
 }
 
-static void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead) {
+// CIRCUITPY-CHANGE: cache_size and readahead_size; 0 selects the previous cache size
+// and disables readahead respectively.
+static void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead, size_t cache_size, size_t readahead_size) {
     self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
     mp_vfs_blockdev_init(&self->blockdev, bdev);
 
     struct LFSx_API (config) * config = &self->config;
     memset(config, 0, sizeof(*config));
+    memset(&self->readahead, 0, sizeof(self->readahead));
+    memset(&self->stats, 0, sizeof(self->stats));
 
-    config->context = &self->blockdev;
+    config->context = self;
 
     config->read = MP_VFS_LFSx(dev_read);
     config->prog = MP_VFS_LFSx(dev_prog);
@@ -92,14 +138,33 @@ static void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     config->block_size = bs;
     config->block_count = bc;
 
+    // CIRCUITPY-CHANGE: The readahead window holds whole reads from within one block.
+    if (readahead_size > read_size) {
+        if (read_size == 0 || readahead_size % read_size != 0 || readahead_size > (size_t)bs) {
+            mp_arg_error_invalid(MP_QSTR_readahead);
+        }
+        self->readahead.buf = m_new(uint8_t, readahead_size);
+        self->readahead.size = readahead_size;
+    }
+
     #if LFS_BUILD_VERSION == 1
+    // littlefs v1 has fixed read and prog caches, so reject a cache_size rather than ignore it.
+    if (cache_size != 0) {
+        mp_arg_error_invalid(MP_QSTR_cachesize);
+    }
     config->lookahead = lookahead;
     config->read_buffer = m_new(uint8_t, config->read_size);
     config->prog_buffer = m_new(uint8_t, config->prog_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
     #else
+    if (cache_size == 0) {
+        cache_size = MIN(config->block_size, (4 * MAX(read_size, prog_size)));
+    } else if (prog_size == 0 || cache_size % read_size != 0 || cache_size % prog_size != 0 || bs % cache_size != 0) {
+        // littlefs asserts on this rather than returning an error.
+        mp_arg_error_invalid(MP_QSTR_cachesize);
+    }
     config->block_cycles = 100;
-    config->cache_size = MIN(config->block_size, (4 * MAX(read_size, prog_size)));
+    config->cache_size = cache_size;
     config->lookahead_size = lookahead;
     config->read_buffer = m_new(uint8_t, config->cache_size);
     config->prog_buffer = m_new(uint8_t, config->cache_size);
@@ -132,7 +197,8 @@ static mp_obj_t MP_VFS_LFSx(make_new)(const mp_obj_type_t * type, size_t n_args,
     self->enable_mtime = args[LFS_MAKE_ARG_mtime].u_bool;
     #endif
     MP_VFS_LFSx(init_config)(self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int, args[LFS_MAKE_ARG_readahead].u_int);
     int ret = LFSx_API(mount)(&self->lfs, &self->config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -146,7 +212,8 @@ static mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_ma
 
     MP_OBJ_VFS_LFSx self;
     MP_VFS_LFSx(init_config)(&self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int, args[LFS_MAKE_ARG_readahead].u_int);
     int ret = LFSx_API(format)(&self.lfs, &self.config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -467,6 +534,18 @@ static mp_obj_t MP_VFS_LFSx(umount)(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(umount_obj), MP_VFS_LFSx(umount));
 
+// CIRCUITPY-CHANGE: Block device reads, progs and erases since construction.
+static mp_obj_t MP_VFS_LFSx(stats)(mp_obj_t self_in) {
+    MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t t[3] = {
+        mp_obj_new_int_from_uint(self->stats.reads),
+        mp_obj_new_int_from_uint(self->stats.progs),
+        mp_obj_new_int_from_uint(self->stats.erases),
+    };
+    return mp_obj_new_tuple(3, t);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(stats_obj), MP_VFS_LFSx(stats));
+
 static const mp_rom_map_elem_t MP_VFS_LFSx(locals_dict_table)[] = {
     { MP_ROM_QSTR(MP_QSTR_mkfs), MP_ROM_PTR(&MP_VFS_LFSx(mkfs_obj)) },
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&MP_VFS_LFSx(open_obj)) },
@@ -481,6 +560,8 @@ static const mp_rom_map_elem_t MP_VFS_LFSx(locals_dict_table)[] = {
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&MP_VFS_LFSx(statvfs_obj)) },
     { MP_ROM_QSTR(MP_QSTR_mount), MP_ROM_PTR(&MP_VFS_LFSx(mount_obj)) },
     { MP_ROM_QSTR(MP_QSTR_umount), MP_ROM_PTR(&MP_VFS_LFSx(umount_obj)) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&MP_VFS_LFSx(stats_obj)) },
 };
 static MP_DEFINE_CONST_DICT(MP_VFS_LFSx(locals_dict), MP_VFS_LFSx(locals_dict_table));
 
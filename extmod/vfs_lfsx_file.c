@@ -170,6 +170,14 @@ static mp_uint_t MP_VFS_LFSx(file_ioctl)(mp_obj_t self_in, mp_uint_t request, ui
         }
         s->offset = res;
         return 0;
+    // CIRCUITPY-CHANGE
+    } else if (request == MP_STREAM_GET_FILESIZE) {
+        int res = LFSx_API(file_size)(&self->vfs->lfs, &self->file);
+        if (res < 0) {
+            *errcode = -res;
+            return MP_STREAM_ERROR;
+        }
+        return res;
     } else if (request == MP_STREAM_FLUSH) {
         int res = LFSx_API(file_sync)(&self->vfs->lfs, &self->file);
         if (res < 0) {
@@ -214,6 +222,8 @@ static const mp_stream_p_t MP_VFS_LFSx(fileio_stream_p) = {
     .read = MP_VFS_LFSx(file_read),
     .write = MP_VFS_LFSx(file_write),
     .ioctl = MP_VFS_LFSx(file_ioctl),
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -230,6 +240,8 @@ static const mp_stream_p_t MP_VFS_LFSx(textio_stream_p) = {
     .write = MP_VFS_LFSx(file_write),
     .ioctl = MP_VFS_LFSx(file_ioctl),
     .is_text = true,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -34,6 +34,8 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+// CIRCUITPY-CHANGE
+#include <sys/stat.h>
 
 #ifdef _WIN32
 #define fsync _commit
@@ -186,6 +188,18 @@ static mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
             s->offset = off;
             return 0;
         }
+        // CIRCUITPY-CHANGE
+        case MP_STREAM_GET_FILESIZE: {
+            struct stat st;
+            MP_THREAD_GIL_EXIT();
+            int ret = fstat(o->fd, &st);
+            MP_THREAD_GIL_ENTER();
+            if (ret < 0) {
+                *errcode = errno;
+                return MP_STREAM_ERROR;
+            }
+            return st.st_size;
+        }
         case MP_STREAM_CLOSE:
             if (o->fd >= 0) {
                 MP_THREAD_GIL_EXIT();
@@ -259,6 +273,8 @@ static const mp_stream_p_t vfs_posix_fileio_stream_p = {
     .read = vfs_posix_file_read,
     .write = vfs_posix_file_write,
     .ioctl = vfs_posix_file_ioctl,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -275,6 +291,8 @@ static const mp_stream_p_t vfs_posix_textio_stream_p = {
     .write = vfs_posix_file_write,
     .ioctl = vfs_posix_file_ioctl,
     .is_text = true,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 #if MICROPY_PY_SYS_STDIO_BUFFER
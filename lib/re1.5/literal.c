@@ -0,0 +1,77 @@
+// Copyright 2014 Paul Sokolovsky.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// CIRCUITPY-CHANGE: find a literal string that every match must contain, so
+// subjects without it can be rejected without running the matcher.
+
+#include "re1.5.h"
+
+static int instlen(const char *pc)
+{
+    switch (*pc) {
+        case Class:
+        case ClassNot:
+            return 2 + *(unsigned char *)(pc + 1) * 2;
+        case Any:
+        case Bol:
+        case Eol:
+        case Match:
+            return 1;
+        default:
+            return 2;
+    }
+}
+
+// Whether a forward jump (alternation or optional term) can bypass pc.
+// Backward jumps only repeat code, which has then been matched once already.
+static bool skippable(ByteProg *prog, int pc)
+{
+    for (int i = 0; i < prog->bytelen; i += instlen(prog->insts + i)) {
+        char op = prog->insts[i];
+        if (op == Jmp || op == Split || op == RSplit) {
+            int target = i + 2 + (signed char)prog->insts[i + 1];
+            if (i < pc && pc < target) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int re1_5_literal(ByteProg *prog, char *lit, int maxlen, bool *is_prefix)
+{
+    // Look for the longest run of unskippable Char instructions; Save
+    // instructions don't consume input so they don't break a run.
+    int run = 0, run_pc = 0, best = 0, best_pc = 0;
+    bool at_start = true, run_prefix = false;
+    *is_prefix = false;
+    for (int pc = NON_ANCHORED_PREFIX; pc < prog->bytelen; pc += instlen(prog->insts + pc)) {
+        char op = prog->insts[pc];
+        if (op == Save) {
+            continue;
+        }
+        if (op == Char && !skippable(prog, pc)) {
+            if (run++ == 0) {
+                run_pc = pc;
+                run_prefix = at_start;
+            }
+            if (run > best) {
+                best = run;
+                best_pc = run_pc;
+                *is_prefix = run_prefix;
+            }
+        } else {
+            run = 0;
+        }
+        at_start = false;
+    }
+
+    int len = 0;
+    for (int pc = best_pc; len < best && len < maxlen; pc += instlen(prog->insts + pc)) {
+        if (prog->insts[pc] == Char) {
+            lit[len++] = prog->insts[pc + 1];
+        }
+    }
+    return len;
+}
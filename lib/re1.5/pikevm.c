@@ -0,0 +1,163 @@
+// Copyright 2007-2009 Russ Cox.  All Rights Reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// CIRCUITPY-CHANGE: Pike VM running directly on the compiled bytecode.
+//
+// All candidate threads advance over the input in lockstep, so a match takes
+// at most O(len(prog) * len(input)) steps whatever the pattern, instead of
+// the exponential worst case of recursiveloop.c. Threads are kept in priority
+// order (Split prefers the next instruction, RSplit the jump target), which
+// selects the same match and captures as the backtracking implementation.
+
+#include "re1.5.h"
+
+typedef struct {
+	Subject *input;
+	const char *insts;
+	int nsubp;
+	unsigned int gen;
+	unsigned int *mark;
+} PikeVM;
+
+// Each thread is stored as its pc followed by its nsubp capture pointers.
+typedef struct {
+	const char **t;
+	int n;
+} ThreadList;
+
+static void
+addthread(PikeVM *vm, ThreadList *l, const char *pc, const char *sp, const char **subp)
+{
+	const char **t;
+	const char *old;
+	int off;
+
+	re1_5_stack_chk();
+
+	for(;;) {
+		// The first (highest priority) thread to reach an instruction wins.
+		if(vm->mark[pc - vm->insts] == vm->gen)
+			return;
+		vm->mark[pc - vm->insts] = vm->gen;
+
+		switch(*pc) {
+		case Jmp:
+			pc += 2 + (signed char)pc[1];
+			continue;
+		case Split:
+			addthread(vm, l, pc + 2, sp, subp);
+			pc += 2 + (signed char)pc[1];
+			continue;
+		case RSplit:
+			addthread(vm, l, pc + 2 + (signed char)pc[1], sp, subp);
+			pc += 2;
+			continue;
+		case Save:
+			off = (unsigned char)pc[1];
+			if(off >= vm->nsubp) {
+				pc += 2;
+				continue;
+			}
+			old = subp[off];
+			subp[off] = sp;
+			addthread(vm, l, pc + 2, sp, subp);
+			subp[off] = old;
+			return;
+		case Bol:
+			if(sp != vm->input->begin_line)
+				return;
+			pc++;
+			continue;
+		case Eol:
+			if(sp != vm->input->end)
+				return;
+			pc++;
+			continue;
+		}
+		// Consumers and Match wait in the list for the next input byte.
+		t = l->t + l->n++ * (vm->nsubp + 1);
+		t[0] = pc;
+		memcpy(t + 1, subp, vm->nsubp * sizeof(*subp));
+		return;
+	}
+}
+
+size_t
+re1_5_pikevm_memsize(ByteProg *prog, int nsubp)
+{
+	// Two thread lists with room for every instruction, and a mark per byte.
+	return 2 * prog->len * (nsubp + 1) * sizeof(const char*) + prog->bytelen * sizeof(unsigned int);
+}
+
+int
+re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored, void *mem)
+{
+	PikeVM vm;
+	ThreadList clist, nlist, tmp;
+	const char **caps;
+	const char *pc;
+	const char *sp;
+	int i, matched = 0;
+
+	vm.input = input;
+	vm.insts = prog->insts;
+	vm.nsubp = nsubp;
+	vm.gen = 1;
+	clist.t = mem;
+	nlist.t = clist.t + prog->len * (nsubp + 1);
+	vm.mark = (unsigned int*)(nlist.t + prog->len * (nsubp + 1));
+	memset(vm.mark, 0, prog->bytelen * sizeof(unsigned int));
+
+	sp = input->begin;
+	clist.n = 0;
+	addthread(&vm, &clist, HANDLE_ANCHORED(prog->insts, is_anchored), sp, subp);
+
+	for(; clist.n > 0; sp++) {
+		vm.gen++;
+		nlist.n = 0;
+		for(i = 0; i < clist.n; i++) {
+			caps = clist.t + i * (nsubp + 1);
+			pc = *caps++;
+			if(*pc == Match) {
+				memcpy(subp, caps, nsubp * sizeof(*subp));
+				matched = 1;
+				// Lower priority threads can't produce a preferred match.
+				break;
+			}
+			if(sp >= input->end)
+				continue;
+			switch(*pc) {
+			case Char:
+				if(*sp != pc[1])
+					continue;
+				pc += 2;
+				break;
+			case Any:
+				pc++;
+				break;
+			case Class:
+			case ClassNot:
+				if(!_re1_5_classmatch(pc + 1, sp))
+					continue;
+				pc += *(unsigned char*)(pc + 1) * 2 + 2;
+				break;
+			case NamedClass:
+				if(!_re1_5_namedclassmatch(pc + 1, sp))
+					continue;
+				pc += 2;
+				break;
+			default:
+				re1_5_fatal("pikevm");
+				continue;
+			}
+			addthread(&vm, &nlist, pc, sp + 1, caps);
+		}
+		if(sp >= input->end)
+			break;
+		tmp = clist;
+		clist = nlist;
+		nlist = tmp;
+	}
+	return matched;
+}
@@ -143,13 +143,19 @@ struct Subject {
 #define RE15_CLASS_NAMED_CLASS_INDICATOR 0
 
 int re1_5_backtrack(ByteProg*, Subject*, const char**, int, int);
-int re1_5_pikevm(ByteProg*, Subject*, const char**, int, int);
+// CIRCUITPY-CHANGE: the caller provides re1_5_pikevm_memsize() bytes of memory
+int re1_5_pikevm(ByteProg*, Subject*, const char**, int, int, void*);
+size_t re1_5_pikevm_memsize(ByteProg*, int);
 int re1_5_recursiveloopprog(ByteProg*, Subject*, const char**, int, int);
+// CIRCUITPY-CHANGE
+int re1_5_recursiveloopprog_bounded(ByteProg*, Subject*, const char**, int, int, int, int);
 int re1_5_recursiveprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_thompsonvm(ByteProg*, Subject*, const char**, int, int);
 
 int re1_5_sizecode(const char *re);
 int re1_5_compilecode(ByteProg *prog, const char *re);
+// CIRCUITPY-CHANGE
+int re1_5_literal(ByteProg *prog, char *lit, int maxlen, bool *is_prefix);
 void re1_5_dumpcode(ByteProg *prog);
 void cleanmarks(ByteProg *prog);
 int _re1_5_classmatch(const char *pc, const char *sp);
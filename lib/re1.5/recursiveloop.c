@@ -3,14 +3,21 @@
 // license that can be found in the LICENSE file.
 
 #include "re1.5.h"
+// CIRCUITPY-CHANGE
+#include <limits.h>
 
+// CIRCUITPY-CHANGE: each call uses one of *steps and one level of depth; once
+// either runs out the search is abandoned and -1 returned.
 static int
-recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int nsubp)
+recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int nsubp, int *steps, int depth)
 {
 	const char *old;
 	int off;
+	int res;
 
 	re1_5_stack_chk();
+	if(--*steps < 0 || depth <= 0)
+		return -1;
 
 	for(;;) {
 		if(inst_is_consumer(*pc)) {
@@ -47,14 +54,14 @@ recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int n
 			continue;
 		case Split:
 			off = (signed char)*pc++;
-			if(recursiveloop(pc, sp, input, subp, nsubp))
-				return 1;
+			if((res = recursiveloop(pc, sp, input, subp, nsubp, steps, depth - 1)))
+				return res;
 			pc = pc + off;
 			continue;
 		case RSplit:
 			off = (signed char)*pc++;
-			if(recursiveloop(pc + off, sp, input, subp, nsubp))
-				return 1;
+			if((res = recursiveloop(pc + off, sp, input, subp, nsubp, steps, depth - 1)))
+				return res;
 			continue;
 		case Save:
 			off = (unsigned char)*pc++;
@@ -63,8 +70,8 @@ recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int n
 			}
 			old = subp[off];
 			subp[off] = sp;
-			if(recursiveloop(pc, sp, input, subp, nsubp))
-				return 1;
+			if((res = recursiveloop(pc, sp, input, subp, nsubp, steps, depth - 1)))
+				return res;
 			subp[off] = old;
 			return 0;
 		case Bol:
@@ -83,5 +90,15 @@ recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int n
 int
 re1_5_recursiveloopprog(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
 {
-	return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp);
+	// CIRCUITPY-CHANGE
+	int steps = INT_MAX;
+	return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp, &steps, INT_MAX);
+}
+
+// CIRCUITPY-CHANGE: as above, but returns -1 (leaving subp undefined) when
+// the match needs more than the given number of steps or recursion depth.
+int
+re1_5_recursiveloopprog_bounded(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored, int steps, int depth)
+{
+	return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp, &steps, depth);
 }
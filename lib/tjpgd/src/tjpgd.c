@@ -700,7 +700,8 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int idct		/* 0: Only decode the huffman stream and DC values, the MCU will not be output */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -758,7 +759,7 @@ static JRESULT mcu_load (
 				}
 			} while (++z < 64);		/* Next AC element */
 
-			if (JD_FORMAT != 2 || !cmp) {	/* C components may not be processed if in grayscale output */
+			if (idct && (JD_FORMAT != 2 || !cmp)) {	/* C components may not be processed if in grayscale output */
 				if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
 					d = (jd_yuv_t)((*tmp / 256) + 128);
 					if (JD_FASTDECODE >= 1) {
@@ -1124,10 +1125,28 @@ JRESULT jd_decomp (
 	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
 	uint8_t scale							/* Output de-scaling factor (0 to 3) */
 )
+{
+	return jd_decomp_rect(jd, outfunc, scale, NULL);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Start to decompress a region of the JPEG file                         */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_decomp_rect (
+	JDEC* jd,								/* Initialized decompression object */
+	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
+	uint8_t scale,							/* Output de-scaling factor (0 to 3) */
+	const JRECT* roi						/* Region to output in scaled pixels, or NULL for the whole image */
+)
 {
 	unsigned int x, y, mx, my;
 	uint16_t rst, rsc;
 	JRESULT rc;
+	int visible;
 
 
 	if (scale > (JD_USE_SCALE ? 3 : 0)) return JDR_PAR;
@@ -1140,16 +1159,22 @@ JRESULT jd_decomp (
 
 	rc = JDR_OK;
 	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
+		if (roi && (y >> scale) > roi->bottom) break;	/* Nothing more to output below the region */
 		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
 			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
 				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
-			if (rc != JDR_OK) return rc;
-			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
+			/* MCUs outside the region still have to be huffman decoded to advance the stream, but skip IDCT and output */
+			visible = !roi || ((x >> scale) <= roi->right && ((x + mx) >> scale) > roi->left
+				&& (y >> scale) <= roi->bottom && ((y + my) >> scale) > roi->top);
+			rc = mcu_load(jd, visible);			/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
 			if (rc != JDR_OK) return rc;
+			if (visible) {
+				rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
+				if (rc != JDR_OK) return rc;
+			}
 		}
 	}
 
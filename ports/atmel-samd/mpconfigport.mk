@@ -25,6 +25,7 @@ ifeq ($(CHIP_FAMILY),samd21)
 # fit in 256kB of flash
 
 CIRCUITPY_AESIO ?= 0
+CIRCUITPY_ARRAYTOOLS ?= 0
 CIRCUITPY_ATEXIT ?= 0
 CIRCUITPY_AUDIOMIXER ?= 0
 CIRCUITPY_AUDIOMP3 ?= 0
@@ -18,6 +18,36 @@
 #include "py/binary.h"
 #include "py/bc.h"
 
+#if CIRCUITPY_VECTORIO
+#include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/vectorio/Circle.h"
+#include "shared-bindings/vectorio/Polygon.h"
+#include "shared-bindings/vectorio/Rectangle.h"
+#include "shared-bindings/vectorio/VectorShape.h"
+#include "shared-module/vectorio/Circle.h"
+#include "shared-module/vectorio/Polygon.h"
+#include "shared-module/vectorio/Rectangle.h"
+#endif
+
+#if CIRCUITPY_DISPLAYIO_UNIX
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#include "shared-module/displayio/area.h"
+#include "shared-module/displayio/display_core.h"
+#endif
+
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/framebufferio/FramebufferDisplay.h"
+#endif
+
+#if MICROPY_VFS_FAT && MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+#include "extmod/vfs_fat.h"
+#include "lib/oofatfs/diskio.h"
+#endif
+
 // expected output of this file is found in extra_coverage.py.exp
 
 #if defined(MICROPY_UNIX_COVERAGE)
@@ -183,6 +213,345 @@ static void pairheap_test(size_t nops, int *ops) {
 }
 
 // function to run extra tests for things that can't be checked by scripts
+#if CIRCUITPY_VECTORIO
+#define VECTORIO_TEST_MAX_PX (40 * 40)
+
+static vectorio_vector_shape_t *vectorio_test_shape(mp_obj_t shape_in) {
+    mp_obj_t vector_shape;
+    if (mp_obj_is_type(shape_in, &vectorio_polygon_type)) {
+        vector_shape = ((vectorio_polygon_t *)MP_OBJ_TO_PTR(shape_in))->draw_protocol_instance;
+    } else if (mp_obj_is_type(shape_in, &vectorio_circle_type)) {
+        vector_shape = ((vectorio_circle_t *)MP_OBJ_TO_PTR(shape_in))->draw_protocol_instance;
+    } else {
+        vector_shape = ((vectorio_rectangle_t *)MP_OBJ_TO_PTR(shape_in))->draw_protocol_instance;
+    }
+    return MP_OBJ_TO_PTR(vector_shape);
+}
+
+// Fills area into buffer and mask, from the spans of each row if use_spans is set or one
+// pixel at a time otherwise. Rows of masked_px pixels at the start of every other row are
+// marked as already drawn. Returns the full coverage result.
+static bool vectorio_test_fill(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace,
+    const displayio_area_t *area, uint16_t masked_px, bool use_spans, uint32_t *mask, uint32_t *buffer) {
+    uint16_t width = displayio_area_width(area);
+    memset(mask, 0, VECTORIO_TEST_MAX_PX / 8);
+    memset(buffer, 0, VECTORIO_TEST_MAX_PX * 2);
+    for (uint16_t y = 0; y < displayio_area_height(area); y += 2) {
+        for (uint16_t x = 0; x < masked_px; x++) {
+            uint16_t i = y * width + x;
+            mask[i / 32] |= 1u << (i % 32);
+        }
+    }
+    get_spans_function *get_spans = self->ishape.get_spans;
+    if (!use_spans) {
+        self->ishape.get_spans = NULL;
+    }
+    bool full_coverage = vectorio_vector_shape_fill_area(self, colorspace, area, mask, buffer);
+    self->ishape.get_spans = get_spans;
+    return full_coverage;
+}
+
+// Prints whether the span and per-pixel fills agree, the coverage result and the number of
+// pixels drawn.
+static void vectorio_test_compare(const char *name, mp_obj_t shape_in, const _displayio_colorspace_t *colorspace,
+    displayio_buffer_transform_t *transform, const displayio_area_t *area, uint16_t masked_px) {
+    vectorio_vector_shape_t *self = vectorio_test_shape(shape_in);
+    vectorio_vector_shape_update_transform(self, transform);
+    uint32_t *mask[2];
+    uint32_t *buffer[2];
+    bool full_coverage[2];
+    for (size_t i = 0; i < 2; i++) {
+        mask[i] = m_new(uint32_t, VECTORIO_TEST_MAX_PX / 32);
+        buffer[i] = m_new(uint32_t, VECTORIO_TEST_MAX_PX / 2);
+        full_coverage[i] = vectorio_test_fill(self, colorspace, area, masked_px, i == 0, mask[i], buffer[i]);
+    }
+    bool same = full_coverage[0] == full_coverage[1]
+        && memcmp(mask[0], mask[1], VECTORIO_TEST_MAX_PX / 8) == 0
+        && memcmp(buffer[0], buffer[1], VECTORIO_TEST_MAX_PX * 2) == 0;
+    int drawn = 0;
+    for (size_t i = 0; i < VECTORIO_TEST_MAX_PX / 32; i++) {
+        drawn += __builtin_popcount(mask[0][i]);
+    }
+    mp_printf(&mp_plat_print, "%s %d %d %d\n", name, same, full_coverage[0], drawn);
+}
+
+// Prints whether area drawn with a transposed transform matches the transposed area drawn
+// without one, using 16-bit pixels.
+static void vectorio_test_transposed(const char *name, mp_obj_t shape_in, const _displayio_colorspace_t *colorspace,
+    displayio_buffer_transform_t *transform, const displayio_area_t *area) {
+    vectorio_vector_shape_t *self = vectorio_test_shape(shape_in);
+    displayio_buffer_transform_t transposed = *transform;
+    transposed.transpose_xy = true;
+    displayio_area_t transposed_area = {area->y1, area->x1, area->y2, area->x2, NULL};
+    uint32_t *mask = m_new(uint32_t, VECTORIO_TEST_MAX_PX / 32);
+    uint16_t *buffer[2];
+    for (size_t i = 0; i < 2; i++) {
+        buffer[i] = m_new(uint16_t, VECTORIO_TEST_MAX_PX);
+        vectorio_vector_shape_update_transform(self, i == 0 ? transform : &transposed);
+        vectorio_test_fill(self, colorspace, i == 0 ? area : &transposed_area, 0, true, mask, (uint32_t *)buffer[i]);
+    }
+    uint16_t width = displayio_area_width(area);
+    uint16_t height = displayio_area_height(area);
+    bool same = true;
+    for (uint16_t y = 0; y < height; y++) {
+        for (uint16_t x = 0; x < width; x++) {
+            same &= buffer[0][y * width + x] == buffer[1][x * height + y];
+        }
+    }
+    mp_printf(&mp_plat_print, "%s %d\n", name, same);
+}
+#endif
+
+#if CIRCUITPY_DISPLAYIO_UNIX
+#define AREA_TEST_MAX_AREAS (6)
+
+static void area_test_print(const char *name, const displayio_area_t *areas, size_t count) {
+    mp_printf(&mp_plat_print, "%s", name);
+    for (size_t i = 0; i < count; i++) {
+        mp_printf(&mp_plat_print, " (%d,%d,%d,%d)", areas[i].x1, areas[i].y1, areas[i].x2, areas[i].y2);
+    }
+    mp_printf(&mp_plat_print, "\n");
+}
+
+// Adds the areas one at a time to at most max_count areas, optionally removes the overlaps that
+// are left and prints the result. Areas that don't fit are reported with "full".
+static void area_test_merge(const char *name, const displayio_area_t *areas, size_t count, size_t max_count,
+    uint32_t overhead, bool remove_overlaps) {
+    displayio_area_t merged[AREA_TEST_MAX_AREAS];
+    size_t merged_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!displayio_area_add_merged(merged, &merged_count, max_count, &areas[i], overhead)) {
+            mp_printf(&mp_plat_print, "%s full at %d\n", name, (int)i);
+            return;
+        }
+    }
+    if (remove_overlaps) {
+        merged_count = displayio_area_remove_overlaps(merged, merged_count, max_count, overhead);
+    }
+    area_test_print(name, merged, merged_count);
+}
+
+// Links the areas into a list, merges them for a 40x30 display and prints the merged areas, or
+// whether nothing was visible or the original list came back instead.
+static void area_test_core_merge(const char *name, displayio_display_core_t *core, displayio_area_t *areas,
+    size_t count, size_t max_count) {
+    for (size_t i = 0; i < count; i++) {
+        areas[i].next = i + 1 < count ? &areas[i + 1] : NULL;
+    }
+    displayio_area_t merged[AREA_TEST_MAX_AREAS];
+    const displayio_area_t *result = displayio_display_core_merge_areas(core, areas, merged, max_count, 0);
+    if (result == NULL) {
+        mp_printf(&mp_plat_print, "%s none\n", name);
+        return;
+    }
+    if (result == areas) {
+        mp_printf(&mp_plat_print, "%s original\n", name);
+        return;
+    }
+    size_t merged_count = 0;
+    for (const displayio_area_t *area = result; area != NULL; area = area->next) {
+        merged_count++;
+    }
+    area_test_print(name, merged, merged_count);
+}
+
+// Prints the areas that tilegrid asks to refresh, finishes the refresh and returns whether every
+// tile in the changed list is inside one of the areas.
+static void tilegrid_test_refresh(const char *name, displayio_tilegrid_t *tilegrid, const uint16_t *changed,
+    size_t changed_count) {
+    displayio_area_t areas[AREA_TEST_MAX_AREAS];
+    size_t count = 0;
+    for (const displayio_area_t *area = displayio_tilegrid_get_refresh_areas(tilegrid, NULL); area != NULL; area = area->next) {
+        areas[count++] = *area;
+    }
+    area_test_print(name, areas, count);
+    bool covered = true;
+    for (size_t i = 0; i < changed_count; i++) {
+        int16_t x1 = tilegrid->x + changed[i * 2] * tilegrid->tile_width;
+        int16_t y1 = tilegrid->y + changed[i * 2 + 1] * tilegrid->tile_height;
+        if (tilegrid->flip_x) {
+            x1 = tilegrid->x + tilegrid->pixel_width - (changed[i * 2] + 1) * tilegrid->tile_width;
+        }
+        displayio_area_t tile = {x1, y1, x1 + tilegrid->tile_width, y1 + tilegrid->tile_height, NULL};
+        bool found = false;
+        for (size_t j = 0; j < count; j++) {
+            displayio_area_t overlap;
+            found |= displayio_area_compute_overlap(&tile, &areas[j], &overlap) && displayio_area_equal(&overlap, &tile);
+        }
+        covered &= found;
+    }
+    if (changed_count > 0) {
+        mp_printf(&mp_plat_print, "%s covered %d\n", name, covered);
+    }
+    displayio_tilegrid_finish_refresh(tilegrid);
+}
+
+static void tilegrid_test_set_tiles(displayio_tilegrid_t *tilegrid, const uint16_t *tiles, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        common_hal_displayio_tilegrid_set_tile(tilegrid, tiles[i * 2], tiles[i * 2 + 1], 1);
+    }
+}
+#endif
+
+#if CIRCUITPY_FRAMEBUFFERIO
+#define SCROLL_TEST_WIDTH (40)
+#define SCROLL_TEST_HEIGHT (30)
+
+static void scroll_test_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *bufinfo) {
+    mp_get_buffer_raise(self_in, bufinfo, MP_BUFFER_WRITE);
+}
+
+static void scroll_test_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmask) {
+}
+
+// A bytearray framebuffer of 16 bit pixels.
+static const framebuffer_p_t scroll_test_framebuffer_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_framebuffer)
+    .get_bufinfo = scroll_test_get_bufinfo,
+    .swapbuffers = scroll_test_swapbuffers,
+};
+
+// Sets up what FramebufferDisplay's constructor would, without the supervisor terminal and tick.
+static void scroll_test_display(framebufferio_framebufferdisplay_obj_t *self, uint16_t rotation, displayio_group_t *group) {
+    bool transposed = rotation == 90 || rotation == 270;
+    self->core = (displayio_display_core_t) {
+        .width = transposed ? SCROLL_TEST_HEIGHT : SCROLL_TEST_WIDTH,
+        .height = transposed ? SCROLL_TEST_WIDTH : SCROLL_TEST_HEIGHT,
+        .colorspace = {.depth = 16, .bytes_per_cell = 2},
+    };
+    displayio_display_core_set_rotation(&self->core, rotation);
+    displayio_display_core_set_root_group(&self->core, group);
+    self->framebuffer = mp_obj_new_bytearray_of_zeros(SCROLL_TEST_WIDTH * SCROLL_TEST_HEIGHT * 2);
+    self->framebuffer_protocol = &scroll_test_framebuffer_proto;
+    self->row_stride = SCROLL_TEST_WIDTH * 2;
+    self->first_pixel_offset = 0;
+    self->auto_refresh = false;
+    self->first_manual_refresh = true;
+}
+
+// Ten by six tiles of 2x2 pixels at 3, 1 with a different pattern in each row of tiles.
+static displayio_tilegrid_t *scroll_test_tilegrid(void) {
+    displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+    common_hal_displayio_bitmap_construct(bitmap, 8, 4, 4);
+    for (int16_t y = 0; y < 4; y++) {
+        for (int16_t x = 0; x < 8; x++) {
+            common_hal_displayio_bitmap_set_pixel(bitmap, x, y, (x * 3 + y * 5) % 16);
+        }
+    }
+    displayio_palette_t *palette = mp_obj_malloc(displayio_palette_t, &displayio_palette_type);
+    common_hal_displayio_palette_construct(palette, 16, false);
+    for (uint32_t i = 0; i < 16; i++) {
+        common_hal_displayio_palette_set_color(palette, i, (i << 20) | ((15 - i) << 12));
+    }
+    displayio_tilegrid_t *tilegrid = mp_obj_malloc(displayio_tilegrid_t, &displayio_tilegrid_type);
+    common_hal_displayio_tilegrid_construct(tilegrid, bitmap, 4, 2, MP_OBJ_FROM_PTR(palette), 10, 6, 2, 2, 3, 1, 0);
+    for (uint16_t y = 0; y < 6; y++) {
+        for (uint16_t x = 0; x < 10; x++) {
+            common_hal_displayio_tilegrid_set_tile(tilegrid, x, y, (x + 3 * y) % 8);
+        }
+    }
+    return tilegrid;
+}
+
+// Prints whether the next refresh scrolls and, after it, whether the framebuffer matches a full
+// refresh of the same state.
+static void scroll_test_refresh(const char *name, framebufferio_framebufferdisplay_obj_t *self) {
+    displayio_tilegrid_scroll_t scroll;
+    if (!self->core.full_refresh &&
+        displayio_group_get_scroll(self->core.current_group, &self->core.area, &scroll)) {
+        mp_printf(&mp_plat_print, "%s scroll %d,%d", name, scroll.dx, scroll.dy);
+        area_test_print("", &scroll.dest, 1);
+    } else {
+        mp_printf(&mp_plat_print, "%s redraw\n", name);
+    }
+    common_hal_framebufferio_framebufferdisplay_refresh(self, NO_FPS_LIMIT, 0);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->framebuffer, &bufinfo, MP_BUFFER_READ);
+    uint8_t scrolled[SCROLL_TEST_WIDTH * SCROLL_TEST_HEIGHT * 2];
+    memcpy(scrolled, bufinfo.buf, sizeof(scrolled));
+    self->core.full_refresh = true;
+    common_hal_framebufferio_framebufferdisplay_refresh(self, NO_FPS_LIMIT, 0);
+    mp_printf(&mp_plat_print, "%s same %d\n", name, memcmp(scrolled, bufinfo.buf, sizeof(scrolled)) == 0);
+}
+#endif
+
+#if MICROPY_VFS_FAT && MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+#define BLOCK_CACHE_TEST_BLOCKS (128)
+#define BLOCK_CACHE_TEST_BLOCK_SIZE (512)
+
+// A native RAM block device that counts the blocks written to it.
+typedef struct {
+    uint8_t data[BLOCK_CACHE_TEST_BLOCKS][BLOCK_CACHE_TEST_BLOCK_SIZE];
+    size_t writes;
+} block_cache_test_ramdisk_t;
+
+static mp_uint_t block_cache_test_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t block, uint32_t count) {
+    block_cache_test_ramdisk_t *self = (block_cache_test_ramdisk_t *)self_in;
+    if (block + count > BLOCK_CACHE_TEST_BLOCKS) {
+        return 1;
+    }
+    memcpy(buf, self->data[block], count * BLOCK_CACHE_TEST_BLOCK_SIZE);
+    return 0;
+}
+
+static mp_uint_t block_cache_test_writeblocks(mp_obj_t self_in, const uint8_t *buf, uint32_t block, uint32_t count) {
+    block_cache_test_ramdisk_t *self = (block_cache_test_ramdisk_t *)self_in;
+    if (block + count > BLOCK_CACHE_TEST_BLOCKS) {
+        return 1;
+    }
+    memcpy(self->data[block], buf, count * BLOCK_CACHE_TEST_BLOCK_SIZE);
+    self->writes += count;
+    return 0;
+}
+
+static bool block_cache_test_ioctl(mp_obj_t self_in, uint32_t cmd, uint32_t arg, size_t *out_value) {
+    *out_value = 0;
+    if (cmd == MP_BLOCKDEV_IOCTL_BLOCK_COUNT) {
+        *out_value = BLOCK_CACHE_TEST_BLOCKS;
+    } else if (cmd == MP_BLOCKDEV_IOCTL_BLOCK_SIZE) {
+        *out_value = BLOCK_CACHE_TEST_BLOCK_SIZE;
+    }
+    return true;
+}
+
+// Sets up a VfsFat on ramdisk the way the supervisor does for CIRCUITPY. cache may be NULL.
+static fs_user_mount_t *block_cache_test_vfs(block_cache_test_ramdisk_t *ramdisk, fs_block_cache_t *cache) {
+    fs_user_mount_t *vfs = m_new0(fs_user_mount_t, 1);
+    vfs->base.type = &mp_fat_vfs_type;
+    vfs->fatfs.drv = vfs;
+    vfs->blockdev.flags = MP_BLOCKDEV_FLAG_NATIVE | MP_BLOCKDEV_FLAG_HAVE_IOCTL;
+    vfs->blockdev.block_size = BLOCK_CACHE_TEST_BLOCK_SIZE;
+    vfs->blockdev.readblocks[0] = mp_const_none;
+    vfs->blockdev.readblocks[1] = (mp_obj_t)ramdisk;
+    vfs->blockdev.readblocks[2] = (mp_obj_t)block_cache_test_readblocks;
+    vfs->blockdev.writeblocks[0] = mp_const_none;
+    vfs->blockdev.writeblocks[1] = (mp_obj_t)ramdisk;
+    vfs->blockdev.writeblocks[2] = (mp_obj_t)block_cache_test_writeblocks;
+    vfs->blockdev.u.ioctl[0] = mp_const_none;
+    vfs->blockdev.u.ioctl[1] = (mp_obj_t)ramdisk;
+    vfs->blockdev.u.ioctl[2] = (mp_obj_t)block_cache_test_ioctl;
+    vfs->block_cache = cache;
+    return vfs;
+}
+
+static void block_cache_test_print(const char *name, fs_user_mount_t *vfs, block_cache_test_ramdisk_t *ramdisk) {
+    mp_printf(&mp_plat_print, "%s writes %d dirty %d\n", name, (int)ramdisk->writes,
+        __builtin_popcount(vfs->block_cache->dirty));
+}
+
+// Returns whether every cached sector matches the block device.
+static bool block_cache_test_written(fs_user_mount_t *vfs, block_cache_test_ramdisk_t *ramdisk) {
+    fs_block_cache_t *cache = vfs->block_cache;
+    bool same = true;
+    for (size_t i = 0; i < MICROPY_FATFS_BLOCK_CACHE_SECTORS; i++) {
+        if (cache->valid & (1U << i)) {
+            same &= memcmp(cache->data[i], ramdisk->data[cache->sector[i]], BLOCK_CACHE_TEST_BLOCK_SIZE) == 0;
+        }
+    }
+    return same;
+}
+#endif
+
 static mp_obj_t extra_coverage(void) {
     // mp_printf (used by ports that don't have a native printf)
     {
@@ -681,6 +1050,49 @@ static mp_obj_t extra_coverage(void) {
         ringbuf_clear(&ringbuf);
         ringbuf_put(&ringbuf, 0xaa);
         mp_printf(&mp_plat_print, "%d\n", ringbuf_get16(&ringbuf));
+
+        // Multi-byte put/get with wrap around.
+        ringbuf_clear(&ringbuf);
+        for (int i = 0; i < RINGBUF_SIZE - 10; ++i) {
+            ringbuf_put(&ringbuf, i);
+            ringbuf_get(&ringbuf);
+        }
+        byte data[RINGBUF_SIZE + 1];
+        for (int i = 0; i < RINGBUF_SIZE + 1; ++i) {
+            data[i] = i;
+        }
+        mp_printf(&mp_plat_print, "%d\n", ringbuf_put_n(&ringbuf, data, 30));
+        mp_printf(&mp_plat_print, "%d %d\n", ringbuf_num_empty(&ringbuf), ringbuf_num_filled(&ringbuf));
+        memset(data, 0, sizeof(data));
+        mp_printf(&mp_plat_print, "%d\n", ringbuf_get_n(&ringbuf, data, 40));
+        mp_printf(&mp_plat_print, "%d %d %d\n", data[0], data[9], data[29]);
+        // Multi-byte put into ringbuf with not enough room.
+        mp_printf(&mp_plat_print, "%d\n", ringbuf_put_n(&ringbuf, data, RINGBUF_SIZE + 1));
+        mp_printf(&mp_plat_print, "%d %d\n", ringbuf_num_empty(&ringbuf), ringbuf_num_filled(&ringbuf));
+
+        // Zero-copy peek/commit.
+        ringbuf_clear(&ringbuf);
+        for (int i = 0; i < RINGBUF_SIZE - 4; ++i) {
+            ringbuf_put(&ringbuf, i);
+            ringbuf_get(&ringbuf);
+        }
+        size_t len;
+        byte *wr = ringbuf_peek_write(&ringbuf, &len);
+        mp_printf(&mp_plat_print, "%d\n", (int)len);
+        memset(wr, 0x11, len);
+        ringbuf_commit_write(&ringbuf, len);
+        wr = ringbuf_peek_write(&ringbuf, &len);
+        mp_printf(&mp_plat_print, "%d\n", (int)len);
+        memset(wr, 0x22, 2);
+        ringbuf_commit_write(&ringbuf, 2);
+        const byte *rd = ringbuf_peek_read(&ringbuf, &len);
+        mp_printf(&mp_plat_print, "%d %02x\n", (int)len, rd[0]);
+        ringbuf_commit_read(&ringbuf, len);
+        rd = ringbuf_peek_read(&ringbuf, &len);
+        mp_printf(&mp_plat_print, "%d %02x\n", (int)len, rd[0]);
+        ringbuf_commit_read(&ringbuf, len);
+        ringbuf_peek_read(&ringbuf, &len);
+        mp_printf(&mp_plat_print, "%d %d\n", (int)len, ringbuf_num_filled(&ringbuf));
     }
 
     // pairheap
@@ -729,6 +1141,314 @@ static mp_obj_t extra_coverage(void) {
         mp_printf(&mp_plat_print, "%d %d\n", mp_obj_is_int(MP_OBJ_NEW_SMALL_INT(1)), mp_obj_is_int(mp_obj_new_int_from_ll(1)));
     }
 
+    #if CIRCUITPY_VECTORIO
+    // vectorio shapes filled from spans and pixel by pixel
+    {
+        mp_printf(&mp_plat_print, "# vectorio\n");
+
+        displayio_palette_t *palette = mp_obj_malloc(displayio_palette_t, &displayio_palette_type);
+        common_hal_displayio_palette_construct(palette, 3, false);
+        common_hal_displayio_palette_set_color(palette, 0, 0x000000);
+        common_hal_displayio_palette_set_color(palette, 1, 0xff8000);
+        common_hal_displayio_palette_set_color(palette, 2, 0x2040c0);
+        displayio_colorconverter_t *dither = mp_obj_malloc(displayio_colorconverter_t, &displayio_colorconverter_type);
+        common_hal_displayio_colorconverter_construct(dither, true, DISPLAYIO_COLORSPACE_RGB888);
+
+        // Concave polygon with a notch, so some rows have two spans.
+        mp_obj_t points[] = {
+            mp_obj_new_tuple(2, (mp_obj_t[]) {MP_OBJ_NEW_SMALL_INT(0), MP_OBJ_NEW_SMALL_INT(0)}),
+            mp_obj_new_tuple(2, (mp_obj_t[]) {MP_OBJ_NEW_SMALL_INT(20), MP_OBJ_NEW_SMALL_INT(3)}),
+            mp_obj_new_tuple(2, (mp_obj_t[]) {MP_OBJ_NEW_SMALL_INT(9), MP_OBJ_NEW_SMALL_INT(11)}),
+            mp_obj_new_tuple(2, (mp_obj_t[]) {MP_OBJ_NEW_SMALL_INT(22), MP_OBJ_NEW_SMALL_INT(24)}),
+            mp_obj_new_tuple(2, (mp_obj_t[]) {MP_OBJ_NEW_SMALL_INT(2), MP_OBJ_NEW_SMALL_INT(19)}),
+        };
+        mp_obj_t polygon_args[] = {
+            MP_OBJ_NEW_QSTR(MP_QSTR_pixel_shader), MP_OBJ_FROM_PTR(palette),
+            MP_OBJ_NEW_QSTR(MP_QSTR_points), mp_obj_new_list(MP_ARRAY_SIZE(points), points),
+            MP_OBJ_NEW_QSTR(MP_QSTR_x), MP_OBJ_NEW_SMALL_INT(5),
+            MP_OBJ_NEW_QSTR(MP_QSTR_y), MP_OBJ_NEW_SMALL_INT(4),
+            MP_OBJ_NEW_QSTR(MP_QSTR_color_index), MP_OBJ_NEW_SMALL_INT(1),
+        };
+        mp_obj_t polygon = mp_call_function_n_kw(MP_OBJ_FROM_PTR(&vectorio_polygon_type), 0, 5, polygon_args);
+        mp_obj_t circle_args[] = {
+            MP_OBJ_NEW_QSTR(MP_QSTR_pixel_shader), MP_OBJ_FROM_PTR(palette),
+            MP_OBJ_NEW_QSTR(MP_QSTR_radius), MP_OBJ_NEW_SMALL_INT(11),
+            MP_OBJ_NEW_QSTR(MP_QSTR_x), MP_OBJ_NEW_SMALL_INT(15),
+            MP_OBJ_NEW_QSTR(MP_QSTR_y), MP_OBJ_NEW_SMALL_INT(14),
+            MP_OBJ_NEW_QSTR(MP_QSTR_color_index), MP_OBJ_NEW_SMALL_INT(2),
+        };
+        mp_obj_t circle = mp_call_function_n_kw(MP_OBJ_FROM_PTR(&vectorio_circle_type), 0, 5, circle_args);
+        mp_obj_t rectangle_args[] = {
+            MP_OBJ_NEW_QSTR(MP_QSTR_pixel_shader), MP_OBJ_FROM_PTR(palette),
+            MP_OBJ_NEW_QSTR(MP_QSTR_width), MP_OBJ_NEW_SMALL_INT(17),
+            MP_OBJ_NEW_QSTR(MP_QSTR_height), MP_OBJ_NEW_SMALL_INT(9),
+            MP_OBJ_NEW_QSTR(MP_QSTR_x), MP_OBJ_NEW_SMALL_INT(3),
+            MP_OBJ_NEW_QSTR(MP_QSTR_y), MP_OBJ_NEW_SMALL_INT(6),
+            MP_OBJ_NEW_QSTR(MP_QSTR_color_index), MP_OBJ_NEW_SMALL_INT(1),
+        };
+        mp_obj_t rectangle = mp_call_function_n_kw(MP_OBJ_FROM_PTR(&vectorio_rectangle_type), 0, 6, rectangle_args);
+
+        _displayio_colorspace_t rgb565 = {.depth = 16, .bytes_per_cell = 2};
+        _displayio_colorspace_t mono = {.depth = 1, .bytes_per_cell = 1, .grayscale = true, .grayscale_bit = 7};
+        displayio_buffer_transform_t identity = {.dx = 1, .dy = 1, .scale = 1, .width = 40, .height = 40};
+        displayio_buffer_transform_t mirrored = {.x = 40, .dx = -1, .dy = 1, .scale = 1, .width = 40, .height = 40, .mirror_x = true};
+        displayio_area_t whole = {0, 0, 40, 40, NULL};
+        displayio_area_t inside = {10, 10, 16, 14, NULL};
+        displayio_area_t clipped = {9, 5, 30, 17, NULL};
+
+        vectorio_test_compare("polygon", polygon, &rgb565, &identity, &whole, 0);
+        vectorio_test_compare("polygon clipped", polygon, &rgb565, &identity, &clipped, 0);
+        vectorio_test_compare("polygon masked", polygon, &rgb565, &identity, &clipped, 7);
+        vectorio_test_compare("polygon mirrored", polygon, &rgb565, &mirrored, &clipped, 0);
+        vectorio_test_compare("polygon mono", polygon, &mono, &identity, &whole, 0);
+        vectorio_test_compare("circle", circle, &rgb565, &identity, &whole, 0);
+        vectorio_test_compare("circle inside", circle, &rgb565, &identity, &inside, 0);
+        vectorio_test_compare("circle clipped", circle, &rgb565, &mirrored, &clipped, 3);
+        vectorio_test_compare("rectangle", rectangle, &rgb565, &identity, &whole, 0);
+        vectorio_test_compare("rectangle clipped", rectangle, &mono, &mirrored, &clipped, 0);
+        common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_test_shape(circle), MP_OBJ_FROM_PTR(dither));
+        vectorio_test_compare("circle dithered", circle, &rgb565, &identity, &clipped, 0);
+        vectorio_test_compare("circle dithered mirrored", circle, &rgb565, &mirrored, &clipped, 0);
+        common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_test_shape(circle), MP_OBJ_FROM_PTR(palette));
+
+        vectorio_test_transposed("polygon transposed", polygon, &rgb565, &identity, &whole);
+        vectorio_test_transposed("circle transposed", circle, &rgb565, &identity, &clipped);
+        vectorio_test_transposed("rectangle transposed", rectangle, &rgb565, &identity, &clipped);
+    }
+    #endif
+
+    #if CIRCUITPY_DISPLAYIO_UNIX
+    // merging refresh areas
+    {
+        mp_printf(&mp_plat_print, "# displayio areas\n");
+
+        displayio_area_t overlapping[] = {{0, 0, 10, 10, NULL}, {2, 0, 12, 10, NULL}};
+        area_test_merge("overlapping", overlapping, 2, 4, 0, false);
+        displayio_area_t nested[] = {{0, 0, 20, 20, NULL}, {5, 5, 10, 10, NULL}};
+        area_test_merge("nested", nested, 2, 4, 0, false);
+        area_test_merge("nested reversed", (displayio_area_t[]) {nested[1], nested[0]}, 2, 4, 0, false);
+        displayio_area_t touching[] = {{0, 0, 10, 10, NULL}, {10, 0, 20, 10, NULL}};
+        area_test_merge("touching", touching, 2, 4, 0, false);
+        displayio_area_t separate[] = {{0, 0, 10, 10, NULL}, {30, 30, 40, 40, NULL}, {0, 0, 0, 5, NULL}};
+        area_test_merge("separate", separate, 3, 4, 0, false);
+        area_test_merge("separate overhead", separate, 3, 4, 1500, false);
+        // The bounding box of the first and last is worth merging with the middle one.
+        displayio_area_t chained[] = {{0, 0, 10, 10, NULL}, {20, 0, 30, 10, NULL}, {10, 0, 20, 10, NULL}};
+        area_test_merge("chained", chained, 3, 4, 0, false);
+        displayio_area_t spread[] = {{0, 0, 5, 5, NULL}, {20, 20, 25, 25, NULL}, {40, 40, 45, 45, NULL}};
+        area_test_merge("spread", spread, 3, 3, 0, false);
+        area_test_merge("spread", spread, 3, 2, 0, false);
+
+        // The arms of an L are kept apart and then one is cut so they don't overlap.
+        displayio_area_t ell[] = {{0, 0, 30, 10, NULL}, {0, 0, 10, 30, NULL}};
+        area_test_merge("ell", ell, 2, 4, 0, false);
+        area_test_merge("ell cut", ell, 2, 4, 0, true);
+        // A cross needs three slots to cut and isn't worth cutting with a large overhead.
+        displayio_area_t cross[] = {{10, 0, 20, 30, NULL}, {0, 10, 30, 20, NULL}};
+        area_test_merge("cross cut", cross, 2, 4, 0, true);
+        area_test_merge("cross cut", cross, 2, 2, 0, true);
+        area_test_merge("cross cut", cross, 2, 4, 150, true);
+
+        // Merging a list of areas clipped to a display.
+        displayio_display_core_t core = {
+            .area = {0, 0, 40, 30, NULL},
+            .colorspace = {.depth = 16, .bytes_per_cell = 2},
+        };
+        displayio_area_t listed[] = {{-5, -5, 10, 10, NULL}, {50, 50, 60, 60, NULL}, {5, 0, 15, 10, NULL}, {0, 0, 5, 30, NULL}};
+        area_test_core_merge("core", &core, listed, 4, 4);
+        area_test_core_merge("core offscreen", &core, listed + 1, 1, 4);
+        displayio_area_t corners[] = {{0, 0, 5, 5, NULL}, {35, 0, 40, 5, NULL}, {0, 25, 5, 30, NULL}};
+        area_test_core_merge("core corners", &core, corners, 3, 3);
+        area_test_core_merge("core corners", &core, corners, 3, 2);
+        core.colorspace = (_displayio_colorspace_t) {.depth = 1, .bytes_per_cell = 1, .pixels_in_byte_share_row = true};
+        displayio_area_t unaligned[] = {{3, 1, 9, 4, NULL}};
+        area_test_core_merge("core mono", &core, unaligned, 1, 4);
+    }
+
+    // tiles changed in a TileGrid
+    {
+        mp_printf(&mp_plat_print, "# tilegrid dirty areas\n");
+
+        displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+        common_hal_displayio_bitmap_construct(bitmap, 4, 2, 1);
+        displayio_palette_t *palette = mp_obj_malloc(displayio_palette_t, &displayio_palette_type);
+        common_hal_displayio_palette_construct(palette, 2, false);
+        // Ten by six tiles of 2x2 pixels at 3, 1.
+        displayio_tilegrid_t *tilegrid = mp_obj_malloc(displayio_tilegrid_t, &displayio_tilegrid_type);
+        common_hal_displayio_tilegrid_construct(tilegrid, bitmap, 2, 1, MP_OBJ_FROM_PTR(palette), 10, 6, 2, 2, 3, 1, 0);
+        displayio_buffer_transform_t identity = {.dx = 1, .dy = 1, .scale = 1, .width = 40, .height = 30};
+        displayio_tilegrid_update_transform(tilegrid, &identity);
+        tilegrid_test_refresh("first", tilegrid, NULL, 0);
+        tilegrid_test_refresh("unchanged", tilegrid, NULL, 0);
+
+        const uint16_t corners[] = {0, 0, 9, 5};
+        tilegrid_test_set_tiles(tilegrid, corners, 2);
+        tilegrid_test_refresh("corners", tilegrid, corners, 2);
+        const uint16_t row[] = {2, 1, 3, 1, 4, 1, 4, 2, 3, 2, 2, 2};
+        tilegrid_test_set_tiles(tilegrid, row, 6);
+        tilegrid_test_refresh("block", tilegrid, row, 6);
+        const uint16_t scattered[] = {0, 0, 9, 0, 0, 5, 9, 5};
+        tilegrid_test_set_tiles(tilegrid, scattered, 4);
+        tilegrid_test_refresh("scattered", tilegrid, scattered, 4);
+        // Once all of the areas are used a tile grows the area that grows least.
+        const uint16_t overflow[] = {0, 0, 9, 0, 0, 5, 9, 5, 1, 4};
+        tilegrid_test_set_tiles(tilegrid, overflow, 5);
+        tilegrid_test_refresh("overflow", tilegrid, overflow, 5);
+        const uint16_t many[] = {0, 0, 9, 0, 0, 5, 9, 5, 4, 2, 2, 4, 7, 1};
+        tilegrid_test_set_tiles(tilegrid, many, 7);
+        tilegrid_test_refresh("many", tilegrid, many, 7);
+
+        common_hal_displayio_tilegrid_set_flip_x(tilegrid, true);
+        tilegrid_test_refresh("flipped", tilegrid, NULL, 0);
+        tilegrid_test_set_tiles(tilegrid, corners, 2);
+        tilegrid_test_refresh("flipped corners", tilegrid, corners, 2);
+    }
+    #endif
+
+    #if CIRCUITPY_FRAMEBUFFERIO
+    // scrolling a TileGrid by moving pixels within the framebuffer
+    {
+        mp_printf(&mp_plat_print, "# framebuffer scroll\n");
+
+        displayio_group_t *group = mp_obj_malloc(displayio_group_t, &displayio_group_type);
+        common_hal_displayio_group_construct(group, 1, 0, 0);
+        displayio_tilegrid_t *tilegrid = scroll_test_tilegrid();
+        common_hal_displayio_group_insert(group, common_hal_displayio_group_get_len(group), MP_OBJ_FROM_PTR(tilegrid));
+        framebufferio_framebufferdisplay_obj_t display;
+        scroll_test_display(&display, 0, group);
+        scroll_test_refresh("first", &display);
+
+        // Scroll up a row and fill in the new last row, as the terminal does.
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 0, 1);
+        for (uint16_t x = 0; x < 10; x++) {
+            common_hal_displayio_tilegrid_set_tile(tilegrid, x, 0, 7 - x % 8);
+        }
+        scroll_test_refresh("up", &display);
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 0, 0);
+        scroll_test_refresh("down", &display);
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 1, 0);
+        scroll_test_refresh("left", &display);
+        common_hal_displayio_tilegrid_set_x(tilegrid, 6);
+        scroll_test_refresh("moved", &display);
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 2, 5);
+        common_hal_displayio_tilegrid_set_y(tilegrid, 4);
+        scroll_test_refresh("moved scrolled", &display);
+        // Tiles set before the scroll are relative to the old top left.
+        common_hal_displayio_tilegrid_set_tile(tilegrid, 3, 3, 1);
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 2, 4);
+        scroll_test_refresh("set then scrolled", &display);
+
+        // Another layer within the copied pixels would move along with them.
+        displayio_tilegrid_t *sibling = scroll_test_tilegrid();
+        common_hal_displayio_tilegrid_set_x(sibling, 20);
+        common_hal_displayio_tilegrid_set_y(sibling, 10);
+        common_hal_displayio_group_insert(group, common_hal_displayio_group_get_len(group), MP_OBJ_FROM_PTR(sibling));
+        scroll_test_refresh("sibling", &display);
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 2, 5);
+        scroll_test_refresh("sibling overlaps", &display);
+        common_hal_displayio_tilegrid_set_x(sibling, 30);
+        common_hal_displayio_tilegrid_set_y(sibling, 20);
+        scroll_test_refresh("sibling moved", &display);
+        common_hal_displayio_tilegrid_set_top_left(tilegrid, 2, 4);
+        scroll_test_refresh("sibling apart", &display);
+
+        // Rotated displays don't map the grid's rows to framebuffer rows so they redraw instead.
+        for (uint16_t rotation = 90; rotation < 360; rotation += 90) {
+            group = mp_obj_malloc(displayio_group_t, &displayio_group_type);
+            common_hal_displayio_group_construct(group, 1, 0, 0);
+            tilegrid = scroll_test_tilegrid();
+            common_hal_displayio_group_insert(group, common_hal_displayio_group_get_len(group), MP_OBJ_FROM_PTR(tilegrid));
+            scroll_test_display(&display, rotation, group);
+            mp_printf(&mp_plat_print, "rotation %d\n", rotation);
+            scroll_test_refresh("first", &display);
+            common_hal_displayio_tilegrid_set_top_left(tilegrid, 0, 1);
+            scroll_test_refresh("up", &display);
+            common_hal_displayio_tilegrid_set_x(tilegrid, 6);
+            scroll_test_refresh("moved", &display);
+        }
+    }
+    #endif
+
+    #if MICROPY_VFS_FAT && MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    // write-back cache of FAT sectors
+    {
+        mp_printf(&mp_plat_print, "# fat block cache\n");
+
+        block_cache_test_ramdisk_t *ramdisk = m_new0(block_cache_test_ramdisk_t, 1);
+        fs_block_cache_t *cache = m_new0(fs_block_cache_t, 1);
+        fs_user_mount_t *vfs = block_cache_test_vfs(ramdisk, cache);
+        uint8_t buf[3 * BLOCK_CACHE_TEST_BLOCK_SIZE];
+
+        // Single sectors are held until synced and reads see them.
+        memset(buf, 0xaa, BLOCK_CACHE_TEST_BLOCK_SIZE);
+        disk_write(vfs, buf, 5, 1);
+        block_cache_test_print("write", vfs, ramdisk);
+        memset(buf, 0, sizeof(buf));
+        disk_read(vfs, buf, 5, 1);
+        mp_printf(&mp_plat_print, "read cached %d %d\n", buf[0], ramdisk->data[5][0]);
+        memset(buf, 0, sizeof(buf));
+        disk_read(vfs, buf, 4, 3);
+        mp_printf(&mp_plat_print, "read through %d %d %d\n", buf[0], buf[BLOCK_CACHE_TEST_BLOCK_SIZE],
+            buf[2 * BLOCK_CACHE_TEST_BLOCK_SIZE]);
+        disk_ioctl(vfs, CTRL_SYNC, NULL);
+        block_cache_test_print("sync", vfs, ramdisk);
+        mp_printf(&mp_plat_print, "sync written %d\n", ramdisk->data[5][0]);
+        disk_ioctl(vfs, CTRL_SYNC, NULL);
+        block_cache_test_print("sync again", vfs, ramdisk);
+
+        // The least recently used sector is written back to make room.
+        for (uint32_t sector = 10; sector < 10 + MICROPY_FATFS_BLOCK_CACHE_SECTORS + 1; sector++) {
+            memset(buf, sector, BLOCK_CACHE_TEST_BLOCK_SIZE);
+            disk_write(vfs, buf, sector, 1);
+        }
+        block_cache_test_print("evict", vfs, ramdisk);
+        mp_printf(&mp_plat_print, "evict written %d %d\n", ramdisk->data[10][0], ramdisk->data[11][0]);
+        // Larger writes go straight through and replace cached copies.
+        memset(buf, 0x55, 2 * BLOCK_CACHE_TEST_BLOCK_SIZE);
+        disk_write(vfs, buf, 13, 2);
+        block_cache_test_print("multiple", vfs, ramdisk);
+        disk_read(vfs, buf, 14, 1);
+        mp_printf(&mp_plat_print, "multiple read %d\n", buf[0]);
+        DSTATUS stat;
+        disk_ioctl(vfs, IOCTL_INIT, &stat);
+        block_cache_test_print("init", vfs, ramdisk);
+        mp_printf(&mp_plat_print, "init valid %d\n", (int)cache->valid);
+
+        // Sectors FatFs writes while a file is open reach the block device on umount.
+        uint8_t work[FF_MAX_SS];
+        f_mkfs(&vfs->fatfs, FM_FAT | FM_SFD, 0, work, sizeof(work));
+        f_mount(&vfs->fatfs);
+        ramdisk->writes = 0;
+        FIL fp;
+        f_open(&vfs->fatfs, &fp, "/test.txt", FA_WRITE | FA_CREATE_ALWAYS);
+        const char line[] = "the quick brown fox jumps over the lazy dog\n";
+        UINT n;
+        for (size_t i = 0; i < 40; i++) {
+            f_write(&fp, line, sizeof(line) - 1, &n);
+        }
+        block_cache_test_print("file", vfs, ramdisk);
+        mp_obj_t umount[2];
+        mp_load_method(MP_OBJ_FROM_PTR(vfs), MP_QSTR_umount, umount);
+        mp_call_method_n_kw(0, 0, umount);
+        block_cache_test_print("umount", vfs, ramdisk);
+        mp_printf(&mp_plat_print, "umount written %d\n", block_cache_test_written(vfs, ramdisk));
+        f_close(&fp);
+        block_cache_test_print("close", vfs, ramdisk);
+
+        // A mount without a cache reads back what was written.
+        fs_user_mount_t *plain = block_cache_test_vfs(ramdisk, NULL);
+        f_mount(&plain->fatfs);
+        f_open(&plain->fatfs, &fp, "/test.txt", FA_READ);
+        bool same = f_size(&fp) == 40 * (sizeof(line) - 1);
+        for (size_t i = 0; i < 40; i++) {
+            f_read(&fp, buf, sizeof(line) - 1, &n);
+            same &= n == sizeof(line) - 1 && memcmp(buf, line, n) == 0;
+        }
+        f_close(&fp);
+        mp_printf(&mp_plat_print, "read back %d\n", same);
+    }
+    #endif
+
     mp_printf(&mp_plat_print, "# end coverage.c\n");
 
     mp_obj_streamtest_t *s = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_fileio);
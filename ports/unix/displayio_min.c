@@ -6,6 +6,7 @@
 
 #include "py/enum.h"
 #include "py/obj.h"
+#include "py/mphal.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/displayio/__init__.h"
@@ -13,6 +14,10 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/displayio/Palette.h"
 
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "supervisor/shared/tick.h"
+#endif
+
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB888, DISPLAYIO_COLORSPACE_RGB888);
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB565, DISPLAYIO_COLORSPACE_RGB565);
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB565_SWAPPED, DISPLAYIO_COLORSPACE_RGB565_SWAPPED);
@@ -87,3 +92,10 @@ displayio_buffer_transform_t null_transform = {
     .mirror_y = false,
     .transpose_xy = false
 };
+
+#if CIRCUITPY_FRAMEBUFFERIO
+// Displays record when they were last refreshed. There is no supervisor tick on unix.
+uint64_t supervisor_ticks_ms64(void) {
+    return mp_hal_ticks_ms();
+}
+#endif
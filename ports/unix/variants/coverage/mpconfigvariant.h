@@ -47,3 +47,6 @@
 #define MICROPY_PY_CRYPTOLIB_CTR      (0)
 // CircuitPython uses shared-bindings struct
 #define MICROPY_PY_STRUCT              (0)
+
+// CIRCUITPY-CHANGE: Test the FAT sector cache that the supervisor gives CIRCUITPY.
+#define MICROPY_FATFS_BLOCK_CACHE_SECTORS (4)
@@ -14,6 +14,11 @@ LDFLAGS += -fprofile-arcs -ftest-coverage
 FROZEN_MANIFEST ?= $(VARIANT_DIR)/manifest.py
 USER_C_MODULES = $(TOP)/examples/usercmodule
 
+# CIRCUITPY-CHANGE: test littlefs even though the unix port doesn't otherwise use it
+MICROPY_VFS_LFS1 = 1
+MICROPY_VFS_LFS2 = 1
+$(BUILD)/lib/littlefs/lfs2.o: CFLAGS += -Wno-shadow
+
 # CIRCUITPY-CHANGE: use CircuitPython bindings and implementations
 SRC_QRIO := $(patsubst ../../%,%,$(wildcard ../../shared-bindings/qrio/*.c ../../shared-module/qrio/*.c ../../lib/quirc/lib/*.c))
 SRC_C += $(SRC_QRIO)
@@ -28,8 +33,11 @@ SRC_BITMAP := \
 	shared/runtime/context_manager_helpers.c \
 	displayio_min.c \
 	shared-bindings/__future__/__init__.c \
+	shared-bindings/adafruit_pixelbuf/__init__.c \
+	shared-bindings/adafruit_pixelbuf/PixelBuf.c \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
+	shared-bindings/arraytools/__init__.c \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
 	shared-bindings/audiocore/WaveFile.c \
@@ -49,7 +57,10 @@ SRC_BITMAP := \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/floppyio/__init__.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
@@ -71,8 +82,11 @@ SRC_BITMAP := \
 	shared-bindings/vectorio/Rectangle.c \
 	shared-bindings/vectorio/VectorShape.c \
 	shared-bindings/zlib/__init__.c \
+	shared-module/adafruit_pixelbuf/__init__.c \
+	shared-module/adafruit_pixelbuf/PixelBuf.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
+	shared-module/arraytools/__init__.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
 	shared-module/audiocore/WaveFile.c \
@@ -89,9 +103,14 @@ SRC_BITMAP := \
 	shared-module/bitmapfilter/__init__.c \
 	shared-module/bitmaptools/__init__.c \
 	shared-module/displayio/area.c \
+	shared-module/displayio/display_core.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/OnDiskBitmap.c \
 	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
+	shared-module/framebufferio/FramebufferDisplay.c \
 	shared-module/floppyio/__init__.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
@@ -116,6 +135,9 @@ SRC_BITMAP := \
 
 SRC_C += $(SRC_BITMAP)
 
+# OnDiskBitmap reads files on a VfsFat, as mp_type_fileio is defined in py/circuitpy_mpconfig.h.
+$(BUILD)/shared-bindings/displayio/OnDiskBitmap.o: CFLAGS += -Dmp_type_fileio=mp_type_vfs_fat_fileio
+
 SRC_C += $(addprefix lib/mp3/src/, \
         bitstream.c \
         buffers.c \
@@ -137,6 +159,7 @@ SRC_C += $(addprefix lib/mp3/src/, \
 $(BUILD)/lib/mp3/src/buffers.o: CFLAGS += -include "shared-module/audiomp3/__init__.h" -D'MPDEC_ALLOCATOR(x)=malloc(x)' -D'MPDEC_FREE(x)=free(x)' -fwrapv
 
 CFLAGS += \
+	-DCIRCUITPY_ADAFRUIT_PIXELBUF=1 \
 	-DCIRCUITPY_AESIO=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
 	-DCIRCUITPY_AUDIOEFFECTS=1 \
@@ -148,7 +171,11 @@ CFLAGS += \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
 	-DCIRCUITPY_CODEOP=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
+	-DCIRCUITPY_DISPLAY_AREA_BUFFER_SIZE=128 \
+	-DCIRCUITPY_DISPLAY_LIMIT=1 \
+	-DCIRCUITPY_DISPLAY_MERGED_AREAS=12 \
 	-DCIRCUITPY_FLOPPYIO=1 \
+	-DCIRCUITPY_FRAMEBUFFERIO=1 \
 	-DCIRCUITPY_FUTURE=1 \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
@@ -158,6 +185,7 @@ CFLAGS += \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
+	-DCIRCUITPY_TILEGRID_DIRTY_AREAS=4 \
 	-DCIRCUITPY_TRACEBACK=1 \
 	-DCIRCUITPY_VECTORIO=1 \
 	-DCIRCUITPY_ZLIB=1
@@ -87,7 +87,14 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_BOUND_METH_CACHE     (CIRCUITPY_OPT_BOUND_METH_CACHE)
+#define MICROPY_OPT_COMPACT_MAP          (CIRCUITPY_OPT_COMPACT_MAP)
+#define MICROPY_OPT_FAST_SUBSTRING_SEARCH (CIRCUITPY_OPT_FAST_SUBSTRING_SEARCH)
+#define MICROPY_OPT_LIST_TIMSORT         (CIRCUITPY_OPT_LIST_TIMSORT)
 #define MICROPY_OPT_MPZ_BITWISE          (0)
+#define MICROPY_OPT_MPZ_FAST_MUL         (CIRCUITPY_OPT_MPZ_FAST_MUL)
+#define MICROPY_OPT_MPZ_FAST_STR         (CIRCUITPY_OPT_MPZ_FAST_STR)
+#define MICROPY_OPT_RE_PIKEVM            (CIRCUITPY_OPT_RE_PIKEVM)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
 
@@ -166,6 +173,12 @@ extern void common_hal_mcu_enable_interrupts(void);
 // Only enable this if you really need it. It allocates a byte cache of this size.
 // #define MICROPY_FATFS_MAX_SS           (4096)
 
+// Sectors cached between FatFs and native block devices, in addition to the FatFs window.
+// Each one costs FF_MAX_SS bytes of RAM per mounted FAT filesystem.
+#ifndef MICROPY_FATFS_BLOCK_CACHE_SECTORS
+#define MICROPY_FATFS_BLOCK_CACHE_SECTORS (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#endif
+
 #define FILESYSTEM_BLOCK_SIZE       (512)
 
 #define MICROPY_VFS                 (1)
@@ -268,6 +281,7 @@ typedef long mp_off_t;
 #define MICROPY_PY_RE_MATCH_GROUPS           (CIRCUITPY_RE)
 #define MICROPY_PY_RE_MATCH_SPAN_START_END   (CIRCUITPY_RE)
 #define MICROPY_PY_RE_SUB                    (CIRCUITPY_RE)
+#define MICROPY_PY_RE_CACHE_SIZE             (CIRCUITPY_RE && CIRCUITPY_FULL_BUILD ? 4 : 0)
 
 #define CIRCUITPY_MICROPYTHON_ADVANCED        (0)
 
@@ -373,6 +387,16 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// Maximum number of non-overlapping areas that changed areas are merged into for each refresh.
+#ifndef CIRCUITPY_DISPLAY_MERGED_AREAS
+#define CIRCUITPY_DISPLAY_MERGED_AREAS (12)
+#endif
+
+// Maximum number of separate rectangles that a TileGrid tracks changed tiles in.
+#ifndef CIRCUITPY_TILEGRID_DIRTY_AREAS
+#define CIRCUITPY_TILEGRID_DIRTY_AREAS (4)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
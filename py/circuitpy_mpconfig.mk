@@ -107,6 +107,9 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+CIRCUITPY_ARRAYTOOLS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_ARRAYTOOLS=$(CIRCUITPY_ARRAYTOOLS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -400,6 +403,27 @@ CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PAT
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_BOUND_METH_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_BOUND_METH_CACHE=$(CIRCUITPY_OPT_BOUND_METH_CACHE)
+
+CIRCUITPY_OPT_COMPACT_MAP ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_COMPACT_MAP=$(CIRCUITPY_OPT_COMPACT_MAP)
+
+CIRCUITPY_OPT_FAST_SUBSTRING_SEARCH ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_FAST_SUBSTRING_SEARCH=$(CIRCUITPY_OPT_FAST_SUBSTRING_SEARCH)
+
+CIRCUITPY_OPT_LIST_TIMSORT ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_LIST_TIMSORT=$(CIRCUITPY_OPT_LIST_TIMSORT)
+
+CIRCUITPY_OPT_MPZ_FAST_MUL ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MPZ_FAST_MUL=$(CIRCUITPY_OPT_MPZ_FAST_MUL)
+
+CIRCUITPY_OPT_MPZ_FAST_STR ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MPZ_FAST_STR=$(CIRCUITPY_OPT_MPZ_FAST_STR)
+
+CIRCUITPY_OPT_RE_PIKEVM ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_RE_PIKEVM=$(CIRCUITPY_OPT_RE_PIKEVM)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
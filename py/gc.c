@@ -613,6 +613,11 @@ void gc_collect_start(void) {
     #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
 
+    // CIRCUITPY-CHANGE: cached bound methods must not keep their objects alive
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    memset(MP_STATE_VM(bound_meth_cache), 0, sizeof(MP_STATE_VM(bound_meth_cache)));
+    #endif
+
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
     // dict_globals, then the root pointer section of mp_state_vm.
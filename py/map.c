@@ -83,6 +83,100 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
     return (x + x / 2) | 1;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_COMPACT_MAP
+// A compact hash map keeps its entries densely at the start of map->table in
+// the order they were added; removed entries have MP_OBJ_SENTINEL keys and
+// entries not used yet have MP_OBJ_NULL keys. Small maps are searched
+// linearly. Larger ones follow the entries with a map_header_t and then a
+// power-of-two sized hash index holding, for each slot, the entry number plus
+// one (zero means the slot is empty). Index slots are 8, 16 or 32 bits wide
+// depending on the size of the map. Removing the last entry lets the next
+// one added reuse its place, so index slots may refer to entries past the
+// filled ones; like slots of removed entries, they are skipped over when
+// searching until the index is rebuilt.
+
+// Maps with at most this many entries have no index.
+#define MAP_LINEAR_MAX (8)
+
+typedef struct _map_header_t {
+    size_t fill; // entries filled so far, live or removed
+    size_t index_used; // non-empty index slots
+} map_header_t;
+
+static inline bool map_is_indexed(size_t alloc) {
+    return alloc > MAP_LINEAR_MAX;
+}
+
+// The smallest power of two that keeps the index at most 2/3 full, so that
+// probe sequences stay short.
+static inline size_t map_index_len(size_t alloc) {
+    size_t x = alloc + alloc / 2 - 1;
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+    #if SIZE_MAX > 0xffffffff
+    x |= x >> 32;
+    #endif
+    return x + 1;
+}
+
+static inline size_t map_index_width(size_t alloc) {
+    return alloc < 0xff ? 1 : alloc < 0xffff ? 2 : 4;
+}
+
+static size_t map_table_bytes(size_t alloc) {
+    size_t n = alloc * sizeof(mp_map_elem_t);
+    if (map_is_indexed(alloc)) {
+        n += sizeof(map_header_t) + map_index_len(alloc) * map_index_width(alloc);
+    }
+    return n;
+}
+
+static inline map_header_t *map_header(const mp_map_t *map) {
+    return (map_header_t *)(map->table + map->alloc);
+}
+
+static inline void *map_index(const mp_map_t *map) {
+    return map_header(map) + 1;
+}
+
+static inline size_t map_index_get(const void *index, size_t width, size_t pos) {
+    if (width == 1) {
+        return ((const uint8_t *)index)[pos];
+    } else if (width == 2) {
+        return ((const uint16_t *)index)[pos];
+    } else {
+        return ((const uint32_t *)index)[pos];
+    }
+}
+
+static inline void map_index_set(void *index, size_t width, size_t pos, size_t value) {
+    if (width == 1) {
+        ((uint8_t *)index)[pos] = value;
+    } else if (width == 2) {
+        ((uint16_t *)index)[pos] = value;
+    } else {
+        ((uint32_t *)index)[pos] = value;
+    }
+}
+
+#define MAP_TABLE_BYTES(alloc) map_table_bytes(alloc)
+#else
+#define MAP_TABLE_BYTES(alloc) ((alloc) * sizeof(mp_map_elem_t))
+#endif
+
+static inline mp_uint_t map_hash(mp_obj_t index) {
+    // fast path for common case of qstr
+    if (mp_obj_is_qstr(index)) {
+        return qstr_hash(MP_OBJ_QSTR_VALUE(index));
+    } else {
+        return MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
+    }
+}
+
 /******************************************************************************/
 /* map                                                                        */
 
@@ -92,7 +186,8 @@ void mp_map_init(mp_map_t *map, size_t n) {
         map->table = NULL;
     } else {
         map->alloc = n;
-        map->table = m_new0(mp_map_elem_t, map->alloc);
+        // CIRCUITPY-CHANGE
+        map->table = (mp_map_elem_t *)m_new0(byte, MAP_TABLE_BYTES(n));
     }
     map->used = 0;
     map->all_keys_are_qstrs = 1;
@@ -112,14 +207,16 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        m_del(byte, map->table, MAP_TABLE_BYTES(map->alloc));
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        // CIRCUITPY-CHANGE
+        m_del(byte, map->table, MAP_TABLE_BYTES(map->alloc));
     }
     map->alloc = 0;
     map->used = 0;
@@ -128,6 +225,68 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_COMPACT_MAP
+// Squeezes out the removed entries, keeping the rest in order, and rebuilds
+// the index.
+void mp_map_compact(mp_map_t *map) {
+    assert(!map->is_fixed && !map->is_ordered);
+    mp_map_elem_t *table = map->table;
+    size_t n = 0;
+    map->all_keys_are_qstrs = 1;
+    for (size_t i = 0; i < map->alloc; i++) {
+        if (mp_map_slot_is_filled(map, i)) {
+            if (!mp_obj_is_qstr(table[i].key)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            table[n++] = table[i];
+        }
+    }
+    mp_seq_clear(table, n, map->alloc, sizeof(*table));
+    if (map_is_indexed(map->alloc)) {
+        map_header(map)->fill = n;
+        map_header(map)->index_used = n;
+        void *index = map_index(map);
+        size_t width = map_index_width(map->alloc);
+        size_t mask = map_index_len(map->alloc) - 1;
+        memset(index, 0, (mask + 1) * width);
+        for (size_t i = 0; i < n; i++) {
+            size_t pos = map_hash(table[i].key) & mask;
+            while (map_index_get(index, width, pos) != 0) {
+                pos = (pos + 1) & mask;
+            }
+            map_index_set(index, width, pos, i + 1);
+        }
+    }
+}
+
+// Returns the most recently added element of a non-empty map.
+mp_map_elem_t *mp_map_last(mp_map_t *map) {
+    assert(map->used > 0 && !map->is_ordered);
+    mp_map_elem_t *elem = &map->table[map_is_indexed(map->alloc) ? map_header(map)->fill : map->alloc];
+    do {
+        elem--;
+    } while (elem->key == MP_OBJ_NULL || elem->key == MP_OBJ_SENTINEL);
+    return elem;
+}
+
+// Called when there is no room for another entry in the table or its index:
+// squeezes out the removed entries if there are enough of them, otherwise
+// moves to a larger table.
+static void mp_map_rehash(mp_map_t *map) {
+    size_t old_alloc = map->alloc;
+    if (map->alloc - map->used <= map->alloc / 4) {
+        size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
+        DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
+        mp_map_elem_t *old_table = map->table;
+        map->table = (mp_map_elem_t *)m_new0(byte, map_table_bytes(new_alloc));
+        memcpy(map->table, old_table, old_alloc * sizeof(mp_map_elem_t));
+        map->alloc = new_alloc;
+        m_del(byte, old_table, map_table_bytes(old_alloc));
+    }
+    mp_map_compact(map);
+}
+#else
 static void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
@@ -146,6 +305,7 @@ static void mp_map_rehash(mp_map_t *map) {
     }
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
+#endif
 
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
@@ -233,6 +393,93 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     // map is a hash table (not an ordered array), so do a hash lookup
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_COMPACT_MAP
+    mp_map_elem_t *elem;
+    if (!map_is_indexed(map->alloc)) {
+        // small map, search the filled entries
+        mp_map_elem_t *top = &map->table[map->alloc];
+        bool index_is_qstr = mp_obj_is_qstr(index);
+        if (!index_is_qstr && !mp_obj_is_small_int(index)) {
+            // raise an exception now if the index is unhashable
+            mp_unary_op(MP_UNARY_OP_HASH, index);
+        }
+        for (elem = map->table; elem < top && elem->key != MP_OBJ_NULL; elem++) {
+            // distinct qstrs are never equal
+            if (elem->key == index
+                || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL
+                    && !(index_is_qstr && mp_obj_is_qstr(elem->key)) && mp_obj_equal(elem->key, index))) {
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    // delete element, freeing any removed entries it ends
+                    map->used--;
+                    elem->key = MP_OBJ_SENTINEL;
+                    if (elem + 1 == top || elem[1].key == MP_OBJ_NULL) {
+                        for (mp_map_elem_t *e = elem; e >= map->table && e->key == MP_OBJ_SENTINEL; e--) {
+                            e->key = MP_OBJ_NULL;
+                        }
+                    }
+                    // keep elem->value so that caller can access it if needed
+                }
+                MAP_CACHE_SET(index, elem - map->table);
+                return elem;
+            }
+        }
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        if (elem == top) {
+            mp_map_rehash(map);
+            return mp_map_lookup(map, index, lookup_kind);
+        }
+    } else {
+        void *idx = map_index(map);
+        size_t width = map_index_width(map->alloc);
+        size_t mask = map_index_len(map->alloc) - 1;
+        size_t pos = map_hash(index) & mask;
+        for (size_t n; (n = map_index_get(idx, width, pos)) != 0; pos = (pos + 1) & mask) {
+            elem = &map->table[n - 1];
+            if (elem->key == index || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL && mp_obj_equal(elem->key, index))) {
+                // found index
+                // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    // delete element, leaving the index slot referring to it
+                    map->used--;
+                    elem->key = MP_OBJ_SENTINEL;
+                    // keep elem->value so that caller can access it if needed
+                    map_header_t *h = map_header(map);
+                    if (n == h->fill) {
+                        // free the trailing removed entries
+                        do {
+                            h->fill--;
+                        } while (h->fill > 0 && map->table[h->fill - 1].key == MP_OBJ_SENTINEL);
+                    }
+                }
+                MAP_CACHE_SET(index, n - 1);
+                return elem;
+            }
+        }
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        map_header_t *h = map_header(map);
+        if (h->fill == map->alloc || h->index_used == map->alloc) {
+            mp_map_rehash(map);
+            return mp_map_lookup(map, index, lookup_kind);
+        }
+        // append the new element, using the empty index slot that ended the search
+        map_index_set(idx, width, pos, h->fill + 1);
+        h->index_used++;
+        elem = &map->table[h->fill++];
+    }
+    map->used++;
+    elem->key = index;
+    elem->value = MP_OBJ_NULL;
+    if (!mp_obj_is_qstr(index)) {
+        map->all_keys_are_qstrs = 0;
+    }
+    return elem;
+    #else
+
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_map_rehash(map);
@@ -241,13 +488,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         }
     }
 
-    // get hash of index, with fast path for common case of qstr
-    mp_uint_t hash;
-    if (mp_obj_is_qstr(index)) {
-        hash = qstr_hash(MP_OBJ_QSTR_VALUE(index));
-    } else {
-        hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
-    }
+    mp_uint_t hash = map_hash(index);
 
     size_t pos = hash % map->alloc;
     size_t start_pos = pos;
@@ -319,6 +560,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             }
         }
     }
+    #endif
 }
 
 /******************************************************************************/
@@ -593,18 +593,87 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to remember recently created bound methods, so that fetching the
+// same method of the same object again (for instance to pass obj.method as a
+// callback) reuses the bound method object rather than allocating a new one.
+// The cache is emptied at the start of each garbage collection, so it never
+// keeps objects alive.
+#ifndef MICROPY_OPT_BOUND_METH_CACHE
+#define MICROPY_OPT_BOUND_METH_CACHE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// How many bound methods to remember; must be a power of two.
+#ifndef MICROPY_OPT_BOUND_METH_CACHE_SIZE
+#define MICROPY_OPT_BOUND_METH_CACHE_SIZE (8)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether hash maps (dicts, globals, instance members) keep their entries
+// densely in insertion order, finding them through a separate index of 8, 16
+// or 32-bit entry numbers in maps of more than 8 entries. This makes dicts
+// and OrderedDicts iterate in insertion order and lets OrderedDict use hashed
+// lookups. Otherwise entries are stored in an open-addressed table, in hash
+// order.
+#ifndef MICROPY_OPT_COMPACT_MAP
+#define MICROPY_OPT_COMPACT_MAP (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to multiply large ints with Karatsuba's algorithm and compute
+// three-argument pow with an odd modulus using Montgomery multiplication and
+// a sliding window.  Uses temporary heap memory of a few times the size of
+// the operands.
+#ifndef MICROPY_OPT_MPZ_FAST_MUL
+#define MICROPY_OPT_MPZ_FAST_MUL (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether to convert large ints to and from strings by splitting them in two
+// with powers of the base, instead of a digit at a time.  Together with
+// MICROPY_OPT_MPZ_FAST_MUL this makes parsing subquadratic.
+#ifndef MICROPY_OPT_MPZ_FAST_STR
+#define MICROPY_OPT_MPZ_FAST_STR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 
 // Whether math.factorial is large, fast and recursive (1) or small and slow (0).
 #ifndef MICROPY_OPT_MATH_FACTORIAL
 #define MICROPY_OPT_MATH_FACTORIAL (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether substring searches in long strings use a skip table (Horspool's
+// algorithm) for needles of 4 bytes or more. Uses 256 bytes of stack while
+// searching.
+#ifndef MICROPY_OPT_FAST_SUBSTRING_SEARCH
+#define MICROPY_OPT_FAST_SUBSTRING_SEARCH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether list.sort and sorted() use a stable merge sort (TimSort) that takes
+// advantage of existing order and calls the key function once per item.
+// Otherwise an unstable quicksort is used, which needs no extra memory.
+#ifndef MICROPY_OPT_LIST_TIMSORT
+#define MICROPY_OPT_LIST_TIMSORT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether the re module bounds the work of its backtracking matcher and falls
+// back to a Pike VM, so matching takes time linear in the length of the
+// subject for any pattern, and skips ahead to (or rejects subjects without) a
+// literal that every match must contain. Otherwise backtracking alone is
+// used, which can take exponential time.
+#ifndef MICROPY_OPT_RE_PIKEVM
+#define MICROPY_OPT_RE_PIKEVM (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 /*****************************************************************************/
 /* Python internal features                                                  */
 
@@ -1719,6 +1788,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_RE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Number of compiled patterns the module-level re functions (match, search,
+// sub) remember, so a pattern used in a loop is only compiled once.
+#ifndef MICROPY_PY_RE_CACHE_SIZE
+#define MICROPY_PY_RE_CACHE_SIZE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 8 : 0)
+#endif
+
 #ifndef MICROPY_PY_HEAPQ
 #define MICROPY_PY_HEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -266,6 +266,12 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    // See mp_obj_new_bound_meth. Not traced by the GC, and cleared when it runs.
+    struct _mp_obj_bound_meth_t *bound_meth_cache[MICROPY_OPT_BOUND_METH_CACHE_SIZE];
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
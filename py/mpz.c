@@ -461,6 +461,220 @@ static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+// CIRCUITPY-CHANGE: faster multiplication of large numbers
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+// Operands with at least this many digits are multiplied with Karatsuba's algorithm.
+// Below this the extra additions cost more than the saved digit multiplications.
+// Must be at least 4 so that the recursion gets smaller.
+#ifndef MPZ_KARATSUBA_THRESHOLD
+#define MPZ_KARATSUBA_THRESHOLD (48)
+#endif
+
+/* computes i = j * j
+   returns number of digits in i
+   assumes enough memory in i; assumes i is zeroed; assumes normalised j
+*/
+static size_t mpn_sqr(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen) {
+    // the products of two different digits appear twice, so add them once and double
+    for (size_t a = 0; a + 1 < jlen; ++a) {
+        mpz_dig_t *id = idig + 2 * a + 1;
+        mpz_dbl_dig_t carry = 0;
+
+        for (size_t b = a + 1; b < jlen; ++b, ++id) {
+            carry += (mpz_dbl_dig_t)*id + (mpz_dbl_dig_t)jdig[a] * (mpz_dbl_dig_t)jdig[b];
+            *id = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+
+        *id = carry;
+        #ifdef RUN_BACKGROUND_TASKS
+        RUN_BACKGROUND_TASKS;
+        #endif
+    }
+
+    mpz_dig_t top = 0;
+    for (size_t a = 0; a < 2 * jlen; ++a) {
+        mpz_dig_t d = idig[a];
+        idig[a] = ((d << 1) | top) & DIG_MASK;
+        top = d >> (DIG_SIZE - 1);
+    }
+
+    // then add the squares of the digits
+    mpz_dbl_dig_t carry = 0;
+    for (size_t a = 0; a < jlen; ++a) {
+        mpz_dbl_dig_t sq = (mpz_dbl_dig_t)jdig[a] * (mpz_dbl_dig_t)jdig[a];
+        carry += (mpz_dbl_dig_t)idig[2 * a] + (sq & DIG_MASK);
+        idig[2 * a] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+        carry += (mpz_dbl_dig_t)idig[2 * a + 1] + (sq >> DIG_SIZE);
+        idig[2 * a + 1] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    size_t ilen = 2 * jlen;
+    while (ilen > 0 && idig[ilen - 1] == 0) {
+        --ilen;
+    }
+    return ilen;
+}
+
+/* computes i = j + k
+   i gets jlen + 1 digits, the last being the carry
+   j, k need not be normalised; assumes jlen >= klen
+*/
+static void mpn_add_n(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
+    mpz_dbl_dig_t carry = 0;
+    size_t a = 0;
+
+    for (; a < klen; ++a) {
+        carry += (mpz_dbl_dig_t)jdig[a] + (mpz_dbl_dig_t)kdig[a];
+        idig[a] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; a < jlen; ++a) {
+        carry += jdig[a];
+        idig[a] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    idig[a] = carry;
+}
+
+/* computes i = i + j
+   i, j need not be normalised; assumes ilen >= jlen and that the sum fits in ilen digits
+*/
+static void mpn_add_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+    size_t a = 0;
+
+    for (; a < jlen; ++a) {
+        carry += (mpz_dbl_dig_t)idig[a] + (mpz_dbl_dig_t)jdig[a];
+        idig[a] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; carry != 0 && a < ilen; ++a) {
+        carry += idig[a];
+        idig[a] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+}
+
+/* computes i = i - j
+   i, j need not be normalised; assumes ilen >= jlen and i >= j
+*/
+static void mpn_sub_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+    size_t a = 0;
+
+    for (; a < jlen; ++a) {
+        borrow += (mpz_dbl_dig_t)idig[a] - (mpz_dbl_dig_t)jdig[a];
+        idig[a] = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; borrow != 0 && a < ilen; ++a) {
+        borrow += idig[a];
+        idig[a] = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+// returns the number of scratch digits that mpn_mul_karatsuba needs for n digit operands
+static size_t mpn_karatsuba_scratch(size_t n) {
+    size_t scratch = 0;
+    while (n >= MPZ_KARATSUBA_THRESHOLD) {
+        n = n - n / 2 + 1;
+        scratch += 4 * n;
+    }
+    return scratch;
+}
+
+/* computes i = j * k where j and k both have n digits
+   i gets 2 * n digits; j, k need not be normalised and can point to the same memory
+   scratch needs mpn_karatsuba_scratch(n) digits
+*/
+static void mpn_mul_karatsuba(mpz_dig_t *idig, mpz_dig_t *jdig, mpz_dig_t *kdig, size_t n, mpz_dig_t *scratch) {
+    if (n < MPZ_KARATSUBA_THRESHOLD) {
+        memset(idig, 0, 2 * n * sizeof(mpz_dig_t));
+        if (jdig == kdig) {
+            mpn_sqr(idig, jdig, n);
+        } else {
+            mpn_mul(idig, jdig, n, kdig, n);
+        }
+        return;
+    }
+
+    // with j = j1 * B^lo + j0 and k = k1 * B^lo + k0:
+    // j * k = j1 * k1 * B^(2 lo) + ((j0 + j1) * (k0 + k1) - j0 * k0 - j1 * k1) * B^lo + j0 * k0
+    size_t lo = n / 2;
+    size_t hi = n - lo;
+    mpz_dig_t *jsum = scratch;
+    mpz_dig_t *ksum = jsum + hi + 1;
+    mpz_dig_t *mid = ksum + hi + 1;
+    scratch = mid + 2 * (hi + 1);
+
+    mpn_mul_karatsuba(idig, jdig, kdig, lo, scratch);
+    mpn_mul_karatsuba(idig + 2 * lo, jdig + lo, kdig + lo, hi, scratch);
+    mpn_add_n(jsum, jdig + lo, hi, jdig, lo);
+    if (jdig == kdig) {
+        ksum = jsum;
+    } else {
+        mpn_add_n(ksum, kdig + lo, hi, kdig, lo);
+    }
+    mpn_mul_karatsuba(mid, jsum, ksum, hi + 1, scratch);
+    mpn_sub_inpl(mid, 2 * (hi + 1), idig, 2 * lo);
+    mpn_sub_inpl(mid, 2 * (hi + 1), idig + 2 * lo, 2 * hi);
+    mpn_add_inpl(idig + lo, 2 * n - lo, mid, 2 * (hi + 1));
+}
+
+/* computes i = j * k like mpn_mul, using Karatsuba's algorithm for large operands
+   returns number of digits in i
+   assumes enough memory in i; assumes i is zeroed; assumes normalised j, k; assumes jlen >= klen
+   can have j, k point to same memory
+*/
+static size_t mpn_mul_fast(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen) {
+    if (klen < MPZ_KARATSUBA_THRESHOLD) {
+        if (jdig == kdig) {
+            return mpn_sqr(idig, jdig, jlen);
+        }
+        return mpn_mul(idig, jdig, jlen, kdig, klen);
+    }
+
+    // multiply k by klen digit pieces of j and add up the products
+    size_t scratch_len = mpn_karatsuba_scratch(klen);
+    mpz_dig_t *scratch = m_new(mpz_dig_t, scratch_len + 3 * klen);
+    mpz_dig_t *prod = scratch + scratch_len;
+    mpz_dig_t *piece = prod + 2 * klen;
+    size_t ilen = jlen + klen;
+
+    for (size_t pos = 0; pos < jlen; pos += klen) {
+        size_t n = MIN(klen, jlen - pos);
+        if (n < MPZ_KARATSUBA_THRESHOLD) {
+            memset(prod, 0, (n + klen) * sizeof(mpz_dig_t));
+            mpn_mul(prod, kdig, klen, jdig + pos, n);
+        } else if (n < klen) {
+            memcpy(piece, jdig + pos, n * sizeof(mpz_dig_t));
+            memset(piece + n, 0, (klen - n) * sizeof(mpz_dig_t));
+            mpn_mul_karatsuba(prod, piece, kdig, klen, scratch);
+        } else {
+            mpn_mul_karatsuba(prod, jdig + pos, kdig, klen, scratch);
+        }
+        mpn_add_inpl(idig + pos, ilen - pos, prod, n + klen);
+    }
+
+    m_del(mpz_dig_t, scratch, scratch_len + 3 * klen);
+
+    while (ilen > 0 && idig[ilen - 1] == 0) {
+        --ilen;
+    }
+    return ilen;
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -817,6 +1031,171 @@ void mpz_set_from_float(mpz_t *z, mp_float_t src) {
 }
 #endif
 
+// CIRCUITPY-CHANGE: faster conversion to and from strings
+
+// Returns the largest power of base that fits in a digit, and in chars the
+// number of characters that it covers.  Conversions handle this many
+// characters per digit operation.
+static mpz_dig_t mpz_str_chunk(unsigned int base, size_t *chars) {
+    mpz_dbl_dig_t big = base;
+    size_t n = 1;
+    while (big * base <= DIG_MASK) {
+        big *= base;
+        ++n;
+    }
+    *chars = n;
+    return big;
+}
+
+#if MICROPY_OPT_MPZ_FAST_STR
+
+// Numbers with at least this many digits are converted to and from strings by
+// splitting them in two with a power of the base, rather than a digit at a time.
+#ifndef MPZ_STR_SPLIT_THRESHOLD
+#define MPZ_STR_SPLIT_THRESHOLD (32)
+#endif
+
+// Returns the powers big ** (2 ** j) for j < *num, stopping early at a power
+// with more than half of max_len digits.
+static mpz_t *mpz_str_new_pows(mpz_dig_t big, size_t *num, size_t max_len) {
+    mpz_t *pows = m_new(mpz_t, *num);
+    mpz_init_zero(&pows[0]);
+    mpz_need_dig(&pows[0], 1);
+    pows[0].dig[0] = big;
+    pows[0].len = 1;
+    size_t n = 1;
+    while (n < *num && pows[n - 1].len * 2 <= max_len + 1) {
+        mpz_init_zero(&pows[n]);
+        mpz_mul_inpl(&pows[n], &pows[n - 1], &pows[n - 1]);
+        ++n;
+    }
+    *num = n;
+    return pows;
+}
+
+static void mpz_str_free_pows(mpz_t *pows, size_t num, size_t alloc) {
+    for (size_t j = 0; j < num; ++j) {
+        mpz_deinit(&pows[j]);
+    }
+    m_del(mpz_t, pows, alloc);
+}
+
+#endif
+
+// Sets z to the value of the n digit characters in str.  Long strings are
+// split in two using pows[j], which is base ** (chars << j).
+static void mpz_set_from_digits(mpz_t *z, const char *str, size_t n, unsigned int base, const mpz_t *pows, size_t num_pows) {
+    size_t chars;
+    mpz_str_chunk(base, &chars);
+
+    #if MICROPY_OPT_MPZ_FAST_STR
+    while (num_pows > 0 && (chars << (num_pows - 1)) >= n) {
+        --num_pows;
+    }
+    if (num_pows > 0 && n >= MPZ_STR_SPLIT_THRESHOLD * chars) {
+        // z = hi * base ** lo_chars + lo, where lo_chars is at least half of n
+        size_t lo_chars = chars << (num_pows - 1);
+        mpz_t lo;
+        mpz_init_zero(&lo);
+        mpz_set_from_digits(z, str, n - lo_chars, base, pows, num_pows - 1);
+        mpz_set_from_digits(&lo, str + n - lo_chars, lo_chars, base, pows, num_pows - 1);
+        mpz_mul_inpl(z, z, &pows[num_pows - 1]);
+        mpz_add_inpl(z, z, &lo);
+        mpz_deinit(&lo);
+        return;
+    }
+    #else
+    (void)pows;
+    (void)num_pows;
+    #endif
+
+    mpz_need_dig(z, n * 8 / DIG_SIZE + 1);
+    z->neg = 0;
+    z->len = 0;
+    for (const char *top = str + n; str < top;) {
+        mpz_dig_t mul = 1;
+        mpz_dig_t add = 0;
+        for (size_t c = 0; c < chars && str < top; ++c, ++str) {
+            mp_uint_t v = (byte)*str;
+            if (v <= '9') {
+                v -= '0';
+            } else if (v <= 'Z') {
+                v -= 'A' - 10;
+            } else {
+                v -= 'a' - 10;
+            }
+            mul *= base;
+            add = add * base + v;
+        }
+        z->len = mpn_mul_dig_add_dig(z->dig, z->len, mul, add);
+    }
+}
+
+/* writes the digits of z to str, least significant first, padded with zeros to at least pad characters
+   returns number of characters written
+   z is destroyed; long numbers are split in two using pows[j], which is base ** (chars << j)
+*/
+static size_t mpz_as_str_rev(char *str, mpz_t *z, unsigned int base, char base_char, const mpz_t *pows, size_t num_pows, size_t pad) {
+    size_t chars;
+    mpz_dig_t big = mpz_str_chunk(base, &chars);
+
+    #if MICROPY_OPT_MPZ_FAST_STR
+    while (num_pows > 0 && z->len >= MPZ_STR_SPLIT_THRESHOLD) {
+        const mpz_t *pow = &pows[--num_pows];
+        if (mpz_cmp(z, pow) >= 0) {
+            // z = quo * pow + rem, where rem has exactly pow_chars characters
+            size_t pow_chars = chars << num_pows;
+            mpz_t quo, rem;
+            mpz_init_zero(&quo);
+            mpz_init_zero(&rem);
+            mpz_divmod_inpl(&quo, &rem, z, pow);
+            char *s = str + mpz_as_str_rev(str, &rem, base, base_char, pows, num_pows, pow_chars);
+            mpz_deinit(&rem);
+            s += mpz_as_str_rev(s, &quo, base, base_char, pows, num_pows, pad > pow_chars ? pad - pow_chars : 0);
+            mpz_deinit(&quo);
+            return s - str;
+        }
+    }
+    #else
+    (void)pows;
+    (void)num_pows;
+    #endif
+
+    mpz_dig_t *dig = z->dig;
+    size_t len = z->len;
+    char *s = str;
+    while (len > 0) {
+        // divide by big, leaving the remainder in a
+        mpz_dbl_dig_t a = 0;
+        for (mpz_dig_t *d = dig + len; --d >= dig;) {
+            a = (a << DIG_SIZE) | *d;
+            *d = a / big;
+            a %= big;
+        }
+        while (len > 0 && dig[len - 1] == 0) {
+            --len;
+        }
+
+        // convert the remainder to characters, all of them unless this is the most significant chunk
+        for (size_t c = 0; c < chars && (len > 0 || a != 0); ++c) {
+            mpz_dig_t v = a % base;
+            a /= base;
+            v += '0';
+            if (v > '9') {
+                v += base_char - '9' - 1;
+            }
+            *s++ = v;
+        }
+    }
+    z->len = 0;
+
+    while ((size_t)(s - str) < pad) {
+        *s++ = '0';
+    }
+
+    return s - str;
+}
+
 // returns number of bytes from str that were processed
 size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigned int base) {
     assert(base <= 36);
@@ -826,16 +1205,10 @@ size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigne
 
     mpz_need_dig(z, len * 8 / DIG_SIZE + 1);
 
-    if (neg) {
-        z->neg = 1;
-    } else {
-        z->neg = 0;
-    }
-
-    z->len = 0;
+    // CIRCUITPY-CHANGE: find the digits first and then convert them in chunks
     for (; cur < top; ++cur) { // XXX UTF8 next char
         // mp_uint_t v = char_to_numeric(cur#); // XXX UTF8 get char
-        mp_uint_t v = *cur;
+        mp_uint_t v = (byte)*cur;
         if ('0' <= v && v <= '9') {
             v -= '0';
         } else if ('A' <= v && v <= 'Z') {
@@ -848,10 +1221,34 @@ size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigne
         if (v >= base) {
             break;
         }
-        z->len = mpn_mul_dig_add_dig(z->dig, z->len, base, v);
+    }
+    len = cur - str;
+
+    #if MICROPY_OPT_MPZ_FAST_STR
+    size_t chars;
+    mpz_dig_t big = mpz_str_chunk(base, &chars);
+    if (len >= MPZ_STR_SPLIT_THRESHOLD * chars) {
+        size_t num_pows = 1;
+        while ((chars << num_pows) < len) {
+            ++num_pows;
+        }
+        size_t alloc = num_pows;
+        mpz_t *pows = mpz_str_new_pows(big, &num_pows, SIZE_MAX - 1);
+        mpz_set_from_digits(z, str, len, base, pows, num_pows);
+        mpz_str_free_pows(pows, num_pows, alloc);
+    } else
+    #endif
+    {
+        mpz_set_from_digits(z, str, len, base, NULL, 0);
+    }
+
+    if (neg) {
+        z->neg = 1;
+    } else {
+        z->neg = 0;
     }
 
-    return cur - str;
+    return len;
 }
 
 void mpz_set_from_bytes(mpz_t *z, bool big_endian, size_t len, const byte *buf) {
@@ -1311,7 +1708,16 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
     memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+    // CIRCUITPY-CHANGE: Karatsuba multiplication for large numbers
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if (lhs->len >= rhs->len) {
+        dest->len = mpn_mul_fast(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    } else {
+        dest->len = mpn_mul_fast(dest->dig, rhs->dig, rhs->len, lhs->dig, lhs->len);
+    }
+    #else
     dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #endif
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1356,6 +1762,155 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+// CIRCUITPY-CHANGE: modular exponentiation with Montgomery multiplication
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+/* computes i = j * k / B^n mod m, where m has n digits and is odd and minv = -1 / m mod B
+   assumes j, k < m; i, j, k have n digits and can point to the same memory
+   t needs 2 * n + 1 digits; scratch needs mpn_karatsuba_scratch(n) digits
+*/
+static void mpn_mont_mul(mpz_dig_t *idig, mpz_dig_t *jdig, mpz_dig_t *kdig, const mpz_dig_t *mdig, size_t n, mpz_dig_t minv, mpz_dig_t *t, mpz_dig_t *scratch) {
+    if (n >= MPZ_KARATSUBA_THRESHOLD) {
+        mpn_mul_karatsuba(t, jdig, kdig, n, scratch);
+    } else {
+        memset(t, 0, 2 * n * sizeof(mpz_dig_t));
+        if (jdig == kdig) {
+            mpn_sqr(t, jdig, n);
+        } else {
+            mpn_mul(t, jdig, n, kdig, n);
+        }
+    }
+    t[2 * n] = 0;
+
+    // add multiples of m to clear the low n digits, leaving t < 2 * m * B^n
+    for (size_t a = 0; a < n; ++a) {
+        mpz_dig_t u = ((mpz_dbl_dig_t)t[a] * (mpz_dbl_dig_t)minv) & DIG_MASK;
+        mpz_dbl_dig_t carry = 0;
+
+        for (size_t b = 0; b < n; ++b) {
+            carry += (mpz_dbl_dig_t)t[a + b] + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)mdig[b];
+            t[a + b] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+
+        for (size_t c = a + n; carry != 0; ++c) {
+            carry += t[c];
+            t[c] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+    }
+
+    if (t[2 * n] != 0 || mpn_cmp(t + n, n, mdig, n) >= 0) {
+        mpn_sub_inpl(t + n, n + 1, mdig, n);
+    }
+    memcpy(idig, t + n, n * sizeof(mpz_dig_t));
+
+    #ifdef RUN_BACKGROUND_TASKS
+    RUN_BACKGROUND_TASKS;
+    #endif
+}
+
+/* computes dest = (lhs ** rhs) % mod using Montgomery multiplication and a sliding window
+   assumes mod is odd and positive; assumes rhs is positive
+   can have dest, lhs, rhs the same; mod can't be the same as dest
+*/
+static void mpz_pow3_mont(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    const mpz_dig_t *mdig = mod->dig;
+    size_t n = mod->len;
+
+    // -1 / m mod B; m * m = 1 mod 8 and each Newton step doubles the number of correct bits
+    mpz_dbl_dig_t inv = mdig[0];
+    for (size_t bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * ((2 - ((mpz_dbl_dig_t)mdig[0] * inv)) & DIG_MASK)) & DIG_MASK;
+    }
+    mpz_dig_t minv = (0 - inv) & DIG_MASK;
+
+    // the exponent is scanned in windows of up to w bits that start and end with a 1 bit
+    size_t ebits = rhs->len * DIG_SIZE;
+    while (((rhs->dig[(ebits - 1) / DIG_SIZE] >> ((ebits - 1) % DIG_SIZE)) & 1) == 0) {
+        --ebits;
+    }
+    size_t w = ebits > 240 ? 5 : ebits > 80 ? 4 : ebits > 24 ? 3 : ebits > 6 ? 2 : 1;
+    size_t num_pows = (size_t)1 << (w - 1);
+
+    // pows holds x, x^3, x^5, ... in Montgomery form, followed by acc, t and the scratch space
+    size_t scratch_len = n >= MPZ_KARATSUBA_THRESHOLD ? mpn_karatsuba_scratch(n) : 0;
+    size_t buf_len = (num_pows + 2) * n + 2 * n + 1 + scratch_len;
+    mpz_dig_t *pows = m_new(mpz_dig_t, buf_len);
+    mpz_dig_t *acc = pows + num_pows * n;
+    mpz_dig_t *x2 = acc + n;
+    mpz_dig_t *t = x2 + n;
+    mpz_dig_t *scratch = t + 2 * n + 1;
+
+    // x = lhs * B^n mod m
+    mpz_t x, quo;
+    mpz_init_zero(&x);
+    mpz_init_zero(&quo);
+    mpz_shl_inpl(&x, lhs, n * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &x, &x, mod);
+    memset(pows, 0, n * sizeof(mpz_dig_t));
+    memcpy(pows, x.dig, x.len * sizeof(mpz_dig_t));
+    mpz_deinit(&x);
+    mpz_deinit(&quo);
+
+    if (num_pows > 1) {
+        mpn_mont_mul(x2, pows, pows, mdig, n, minv, t, scratch);
+        for (size_t a = 1; a < num_pows; ++a) {
+            mpn_mont_mul(pows + a * n, pows + (a - 1) * n, x2, mdig, n, minv, t, scratch);
+        }
+    }
+
+    bool started = false;
+    size_t top = ebits;
+    while (top > 0) {
+        size_t bit = top - 1;
+        if (((rhs->dig[bit / DIG_SIZE] >> (bit % DIG_SIZE)) & 1) == 0) {
+            mpn_mont_mul(acc, acc, acc, mdig, n, minv, t, scratch);
+            top = bit;
+            continue;
+        }
+
+        // the window is bits low to bit, ending with a 1 bit at low
+        size_t low = bit + 1 >= w ? bit + 1 - w : 0;
+        while (((rhs->dig[low / DIG_SIZE] >> (low % DIG_SIZE)) & 1) == 0) {
+            ++low;
+        }
+        size_t val = 0;
+        for (size_t b = bit + 1; b > low; --b) {
+            val = (val << 1) | ((rhs->dig[(b - 1) / DIG_SIZE] >> ((b - 1) % DIG_SIZE)) & 1);
+        }
+
+        mpz_dig_t *pow = pows + (val >> 1) * n;
+        if (started) {
+            for (size_t b = low; b <= bit; ++b) {
+                mpn_mont_mul(acc, acc, acc, mdig, n, minv, t, scratch);
+            }
+            mpn_mont_mul(acc, acc, pow, mdig, n, minv, t, scratch);
+        } else {
+            memcpy(acc, pow, n * sizeof(mpz_dig_t));
+            started = true;
+        }
+        top = low;
+    }
+
+    // multiplying by 1 takes acc out of Montgomery form
+    memset(x2, 0, n * sizeof(mpz_dig_t));
+    x2[0] = 1;
+    mpn_mont_mul(acc, acc, x2, mdig, n, minv, t, scratch);
+
+    mpz_need_dig(dest, n);
+    memcpy(dest->dig, acc, n * sizeof(mpz_dig_t));
+    dest->len = n;
+    while (dest->len > 0 && dest->dig[dest->len - 1] == 0) {
+        --dest->len;
+    }
+    dest->neg = 0;
+
+    m_del(mpz_dig_t, pows, buf_len);
+}
+
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1371,6 +1926,14 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    // CIRCUITPY-CHANGE: use Montgomery multiplication when the modulus allows it
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if (!mod->neg && (mod->dig[0] & 1) != 0) {
+        mpz_pow3_mont(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_t *x = mpz_clone(lhs);
     mpz_t *n = mpz_clone(rhs);
     mpz_t quo;
@@ -1682,48 +2245,43 @@ size_t mpz_as_str_inpl(const mpz_t *i, unsigned int base, const char *prefix, ch
         return s - str;
     }
 
+    // CIRCUITPY-CHANGE: convert a chunk of characters per division, and split
+    // long numbers in two with powers of the base
     // make a copy of mpz digits, so we can do the div/mod calculation
-    mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
-    memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
-
-    // convert
-    char *last_comma = str;
-    bool done;
-    do {
-        mpz_dig_t *d = dig + ilen;
-        mpz_dbl_dig_t a = 0;
-
-        // compute next remainder
-        while (--d >= dig) {
-            a = (a << DIG_SIZE) | *d;
-            *d = a / base;
-            a %= base;
-        }
+    mpz_t z;
+    mpz_init_zero(&z);
+    mpz_set(&z, i);
+    z.neg = 0;
+
+    #if MICROPY_OPT_MPZ_FAST_STR
+    if (ilen >= MPZ_STR_SPLIT_THRESHOLD) {
+        size_t chars;
+        mpz_dig_t big = mpz_str_chunk(base, &chars);
+        size_t num_pows = 8 * sizeof(size_t);
+        size_t alloc = num_pows;
+        mpz_t *pows = mpz_str_new_pows(big, &num_pows, ilen);
+        s += mpz_as_str_rev(s, &z, base, base_char, pows, num_pows, 0);
+        mpz_str_free_pows(pows, num_pows, alloc);
+    } else
+    #endif
+    {
+        s += mpz_as_str_rev(s, &z, base, base_char, NULL, 0, 0);
+    }
 
-        // convert to character
-        a += '0';
-        if (a > '9') {
-            a += base_char - '9' - 1;
-        }
-        *s++ = a;
-
-        // check if number is zero
-        done = true;
-        for (d = dig; d < dig + ilen; ++d) {
-            if (*d != 0) {
-                done = false;
-                break;
+    // free the copy of the digits array
+    mpz_deinit(&z);
+
+    // separate groups of three digits, working back from the end
+    if (comma) {
+        size_t n = s - str;
+        s += (n - 1) / 3;
+        for (size_t k = n; k-- > 0;) {
+            str[k + k / 3] = str[k];
+            if (k % 3 == 0 && k > 0) {
+                str[k + k / 3 - 1] = comma;
             }
         }
-        if (comma && (s - last_comma) == 3) {
-            *s++ = comma;
-            last_comma = s;
-        }
     }
-    while (!done);
-
-    // free the copy of the digits array
-    m_del(mpz_dig_t, dig, ilen);
 
     if (prefix) {
         const char *p = &prefix[strlen(prefix)];
@@ -141,8 +141,22 @@ MP_DEFINE_CONST_OBJ_TYPE(
     );
 
 mp_obj_t mp_obj_new_bound_meth(mp_obj_t meth, mp_obj_t self) {
+    // CIRCUITPY-CHANGE: bound methods are immutable, so a recent one for the
+    // same method and object can be handed out again instead of allocating.
+    // The slot is read once, as another thread may replace it at any time.
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    mp_obj_bound_meth_t **slot = &MP_STATE_VM(bound_meth_cache)[
+        (((mp_uint_t)meth >> 3) ^ ((mp_uint_t)self >> 4)) & (MICROPY_OPT_BOUND_METH_CACHE_SIZE - 1)];
+    mp_obj_bound_meth_t *cached = *slot;
+    if (cached != NULL && cached->meth == meth && cached->self == self) {
+        return MP_OBJ_FROM_PTR(cached);
+    }
+    #endif
     mp_obj_bound_meth_t *o = mp_obj_malloc(mp_obj_bound_meth_t, &mp_type_bound_meth);
     o->meth = meth;
     o->self = self;
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    *slot = o;
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
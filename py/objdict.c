@@ -135,7 +135,8 @@ static mp_obj_t dict_new_typed(const mp_obj_type_t *type, const size_t n) {
     mp_obj_t dict_out = mp_obj_new_dict(n);
     mp_obj_dict_t *dict = MP_OBJ_TO_PTR(dict_out);
     dict->base.type = type;
-    #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+    // CIRCUITPY-CHANGE: compact maps are always in insertion order
+    #if MICROPY_PY_COLLECTIONS_ORDEREDDICT && !MICROPY_OPT_COMPACT_MAP
     if (type == &mp_type_ordereddict) {
         dict->map.is_ordered = 1;
     }
@@ -147,7 +148,8 @@ mp_obj_t mp_obj_dict_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
     mp_obj_t dict_out = mp_obj_new_dict(0);
     mp_obj_dict_t *dict = MP_OBJ_TO_PTR(dict_out);
     dict->base.type = type;
-    #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+    // CIRCUITPY-CHANGE: compact maps are always in insertion order
+    #if MICROPY_PY_COLLECTIONS_ORDEREDDICT && !MICROPY_OPT_COMPACT_MAP
     if (type == &mp_type_ordereddict) {
         dict->map.is_ordered = 1;
     }
@@ -308,8 +310,17 @@ mp_obj_t mp_obj_dict_copy(mp_obj_t self_in) {
     other->map.used = self->map.used;
     other->map.all_keys_are_qstrs = self->map.all_keys_are_qstrs;
     other->map.is_fixed = 0;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_COMPACT_MAP
+    // Copy the entries and index them, turning an ordered (fixed) map into a
+    // hash map.
+    other->map.is_ordered = 0;
+    memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    mp_map_compact(&other->map);
+    #else
     other->map.is_ordered = self->map.is_ordered;
     memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    #endif
     return other_out;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(dict_copy_obj, mp_obj_dict_copy);
@@ -404,6 +415,13 @@ static mp_obj_t dict_popitem(mp_obj_t self_in) {
         // CIRCUITPY-CHANGE: different message
         mp_raise_msg_varg(&mp_type_KeyError, MP_ERROR_TEXT("pop from empty %q"), MP_QSTR_dict);
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_COMPACT_MAP
+    // remove the most recently added element
+    mp_map_elem_t *next = mp_map_last(&self->map);
+    mp_obj_t items[] = {next->key, next->value};
+    mp_map_lookup(&self->map, next->key, MP_MAP_LOOKUP_REMOVE_IF_FOUND)->value = MP_OBJ_NULL;
+    #else
     size_t cur = 0;
     #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
     if (self->map.is_ordered) {
@@ -416,6 +434,7 @@ static mp_obj_t dict_popitem(mp_obj_t self_in) {
     mp_obj_t items[] = {next->key, next->value};
     next->key = MP_OBJ_SENTINEL; // must mark key as sentinel to indicate that it was deleted
     next->value = MP_OBJ_NULL;
+    #endif
     mp_obj_t tuple = mp_obj_new_tuple(2, items);
 
     return tuple;
@@ -491,6 +510,12 @@ static mp_obj_t dict_move_to_end(size_t n_args, const mp_obj_t *pos_args, mp_map
     mp_obj_t *key = args[ARG_key].u_obj;
     bool last = args[ARG_last].u_bool;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_COMPACT_MAP
+    // Squeeze out removed entries so the elements are table[0..used).
+    mp_map_compact(&self->map);
+    #endif
+
     mp_map_elem_t *elem = mp_map_lookup(&self->map, key, MP_MAP_LOOKUP);
     if (!elem) {
         mp_raise_type_arg(&mp_type_KeyError, key);
@@ -515,6 +540,10 @@ static mp_obj_t dict_move_to_end(size_t n_args, const mp_obj_t *pos_args, mp_map
     }
     memmove(move_dest, move_begin, move_count * sizeof(*elem));
     *dest = tmp;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_COMPACT_MAP
+    mp_map_compact(&self->map);
+    #endif
 
     return mp_const_none;
 }
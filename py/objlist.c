@@ -311,6 +311,549 @@ static mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return mp_obj_list_pop(self, index);
 }
 
+#if MICROPY_OPT_LIST_TIMSORT
+// CIRCUITPY-CHANGE: a stable TimSort, following CPython's listsort.txt. Runs that are already in
+// order are found and merged, galloping when one run keeps winning. Elements are width objects
+// wide and the first object is the one compared, so that precomputed keys can be sorted along
+// with their items.
+
+// Enough pending runs for any list that fits in memory, given the run length invariants.
+#define LIST_SORT_MAX_RUNS (sizeof(size_t) * 8 * 4 / 3 + 1)
+#define LIST_SORT_MIN_GALLOP (7)
+
+typedef enum {
+    LIST_SORT_CMP_OBJ,
+    LIST_SORT_CMP_SMALL_INT,
+    LIST_SORT_CMP_STR,
+} list_sort_cmp_t;
+
+typedef struct _list_sort_run_t {
+    mp_obj_t *base;
+    size_t len;
+} list_sort_run_t;
+
+typedef struct _list_sort_t {
+    size_t width;
+    list_sort_cmp_t cmp;
+    bool reverse;
+    mp_int_t min_gallop;
+    mp_obj_t *tmp;
+    size_t tmp_alloc; // in objects
+    // Elements that are in tmp during a merge and where they go if a comparison raises.
+    mp_obj_t *pending_dest;
+    mp_obj_t *pending_src;
+    size_t pending_len;
+    size_t num_runs;
+    list_sort_run_t runs[LIST_SORT_MAX_RUNS];
+} list_sort_t;
+
+static bool list_sort_less(const list_sort_t *s, const mp_obj_t *a, const mp_obj_t *b) {
+    if (s->reverse) {
+        const mp_obj_t *t = a;
+        a = b;
+        b = t;
+    }
+    switch (s->cmp) {
+        case LIST_SORT_CMP_SMALL_INT:
+            return MP_OBJ_SMALL_INT_VALUE(a[0]) < MP_OBJ_SMALL_INT_VALUE(b[0]);
+        case LIST_SORT_CMP_STR: {
+            size_t a_len, b_len;
+            const char *a_data = mp_obj_str_get_data(a[0], &a_len);
+            const char *b_data = mp_obj_str_get_data(b[0], &b_len);
+            int c = memcmp(a_data, b_data, MIN(a_len, b_len));
+            return c < 0 || (c == 0 && a_len < b_len);
+        }
+        default:
+            return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a[0], b[0]));
+    }
+}
+
+#define EL(p, i) ((p) + (i) * (mp_int_t)s->width)
+
+static inline void list_sort_move(const list_sort_t *s, mp_obj_t *dest, const mp_obj_t *src, size_t n) {
+    memmove(dest, src, n * s->width * sizeof(mp_obj_t));
+}
+
+static void list_sort_reverse(const list_sort_t *s, mp_obj_t *lo, mp_obj_t *hi) {
+    // hi is the last element.
+    while (lo < hi) {
+        for (size_t i = 0; i < s->width; i++) {
+            mp_obj_t t = lo[i];
+            lo[i] = hi[i];
+            hi[i] = t;
+        }
+        lo = EL(lo, 1);
+        hi = EL(hi, -1);
+    }
+}
+
+// Sorts a[0:n] where a[0:start] is already sorted.
+static void list_sort_binary_insertion(const list_sort_t *s, mp_obj_t *a, size_t start, size_t n) {
+    mp_obj_t pivot[2];
+    for (size_t i = start; i < n; i++) {
+        // Find the first element that is greater than a[i] so that equal elements stay in order.
+        size_t lo = 0;
+        size_t hi = i;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (list_sort_less(s, EL(a, i), EL(a, mid))) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        if (lo < i) {
+            list_sort_move(s, pivot, EL(a, i), 1);
+            list_sort_move(s, EL(a, lo + 1), EL(a, lo), i - lo);
+            list_sort_move(s, EL(a, lo), pivot, 1);
+        }
+    }
+}
+
+// Returns the length of the run at the start of a[0:n], reversing it if it is strictly descending.
+static size_t list_sort_count_run(const list_sort_t *s, mp_obj_t *a, size_t n) {
+    if (n == 1) {
+        return 1;
+    }
+    size_t i = 2;
+    if (list_sort_less(s, EL(a, 1), EL(a, 0))) {
+        while (i < n && list_sort_less(s, EL(a, i), EL(a, i - 1))) {
+            i++;
+        }
+        list_sort_reverse(s, a, EL(a, i - 1));
+    } else {
+        while (i < n && !list_sort_less(s, EL(a, i), EL(a, i - 1))) {
+            i++;
+        }
+    }
+    return i;
+}
+
+// Returns k such that a[k - 1] < key <= a[k], starting the search at a[hint].
+static size_t list_sort_gallop_left(const list_sort_t *s, const mp_obj_t *key, const mp_obj_t *a, mp_int_t n, mp_int_t hint) {
+    mp_int_t last_ofs = 0;
+    mp_int_t ofs = 1;
+    if (list_sort_less(s, EL(a, hint), key)) {
+        // Gallop right until a[hint + last_ofs] < key <= a[hint + ofs].
+        mp_int_t max_ofs = n - hint;
+        while (ofs < max_ofs && list_sort_less(s, EL(a, hint + ofs), key)) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = MIN(ofs, max_ofs);
+        last_ofs += hint;
+        ofs += hint;
+    } else {
+        // Gallop left until a[hint - ofs] < key <= a[hint - last_ofs].
+        mp_int_t max_ofs = hint + 1;
+        while (ofs < max_ofs && !list_sort_less(s, EL(a, hint - ofs), key)) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = MIN(ofs, max_ofs);
+        mp_int_t k = last_ofs;
+        last_ofs = hint - ofs;
+        ofs = hint - k;
+    }
+    // Binary search with a[last_ofs] < key <= a[ofs].
+    last_ofs++;
+    while (last_ofs < ofs) {
+        mp_int_t m = last_ofs + ((ofs - last_ofs) >> 1);
+        if (list_sort_less(s, EL(a, m), key)) {
+            last_ofs = m + 1;
+        } else {
+            ofs = m;
+        }
+    }
+    return ofs;
+}
+
+// Returns k such that a[k - 1] <= key < a[k], starting the search at a[hint].
+static size_t list_sort_gallop_right(const list_sort_t *s, const mp_obj_t *key, const mp_obj_t *a, mp_int_t n, mp_int_t hint) {
+    mp_int_t last_ofs = 0;
+    mp_int_t ofs = 1;
+    if (list_sort_less(s, key, EL(a, hint))) {
+        // Gallop left until a[hint - ofs] <= key < a[hint - last_ofs].
+        mp_int_t max_ofs = hint + 1;
+        while (ofs < max_ofs && list_sort_less(s, key, EL(a, hint - ofs))) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = MIN(ofs, max_ofs);
+        mp_int_t k = last_ofs;
+        last_ofs = hint - ofs;
+        ofs = hint - k;
+    } else {
+        // Gallop right until a[hint + last_ofs] <= key < a[hint + ofs].
+        mp_int_t max_ofs = n - hint;
+        while (ofs < max_ofs && !list_sort_less(s, key, EL(a, hint + ofs))) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = MIN(ofs, max_ofs);
+        last_ofs += hint;
+        ofs += hint;
+    }
+    // Binary search with a[last_ofs] <= key < a[ofs].
+    last_ofs++;
+    while (last_ofs < ofs) {
+        mp_int_t m = last_ofs + ((ofs - last_ofs) >> 1);
+        if (list_sort_less(s, key, EL(a, m))) {
+            ofs = m;
+        } else {
+            last_ofs = m + 1;
+        }
+    }
+    return ofs;
+}
+
+static mp_obj_t *list_sort_get_tmp(list_sort_t *s, size_t n) {
+    n *= s->width;
+    if (n > s->tmp_alloc) {
+        s->tmp = m_renew(mp_obj_t, s->tmp, s->tmp_alloc, n);
+        s->tmp_alloc = n;
+    }
+    return s->tmp;
+}
+
+// Records where the elements still in tmp go if a comparison raises.
+#define PENDING(dest, src, n) (s->pending_dest = (dest), s->pending_src = (src), s->pending_len = (n))
+
+// Merges the na elements at a with the nb elements that follow, with na <= nb. a[0] is known to
+// belong after b[0] and a[na - 1] is known to belong at the end.
+static void list_sort_merge_lo(list_sort_t *s, mp_obj_t *a, size_t na, mp_obj_t *b, size_t nb) {
+    mp_obj_t *dest = a;
+    a = list_sort_get_tmp(s, na);
+    list_sort_move(s, a, dest, na);
+    list_sort_move(s, dest, b, 1);
+    dest = EL(dest, 1);
+    b = EL(b, 1);
+    nb--;
+    mp_int_t min_gallop = s->min_gallop;
+    while (nb > 0 && na > 1) {
+        size_t a_count = 0;
+        size_t b_count = 0;
+        // Take one element at a time until one run wins often enough.
+        do {
+            PENDING(dest, a, na);
+            if (list_sort_less(s, b, a)) {
+                list_sort_move(s, dest, b, 1);
+                b = EL(b, 1);
+                nb--;
+                b_count++;
+                a_count = 0;
+            } else {
+                list_sort_move(s, dest, a, 1);
+                a = EL(a, 1);
+                na--;
+                a_count++;
+                b_count = 0;
+            }
+            dest = EL(dest, 1);
+        } while (nb > 0 && na > 1 && a_count < (size_t)min_gallop && b_count < (size_t)min_gallop);
+        // Then gallop for as long as that copies long stretches.
+        min_gallop++;
+        while (nb > 0 && na > 1) {
+            min_gallop -= min_gallop > 1;
+            s->min_gallop = min_gallop;
+            PENDING(dest, a, na);
+            a_count = list_sort_gallop_right(s, b, a, na, 0);
+            list_sort_move(s, dest, a, a_count);
+            dest = EL(dest, a_count);
+            a = EL(a, a_count);
+            na -= a_count;
+            if (na <= 1) {
+                break;
+            }
+            list_sort_move(s, dest, b, 1);
+            dest = EL(dest, 1);
+            b = EL(b, 1);
+            nb--;
+            if (nb == 0) {
+                break;
+            }
+            PENDING(dest, a, na);
+            b_count = list_sort_gallop_left(s, a, b, nb, 0);
+            list_sort_move(s, dest, b, b_count);
+            dest = EL(dest, b_count);
+            b = EL(b, b_count);
+            nb -= b_count;
+            if (nb == 0) {
+                break;
+            }
+            list_sort_move(s, dest, a, 1);
+            dest = EL(dest, 1);
+            a = EL(a, 1);
+            na--;
+            if (a_count < LIST_SORT_MIN_GALLOP && b_count < LIST_SORT_MIN_GALLOP) {
+                min_gallop++;
+                s->min_gallop = min_gallop;
+                break;
+            }
+        }
+    }
+    if (na == 1 && nb > 0) {
+        // The last element of a belongs at the end.
+        list_sort_move(s, dest, b, nb);
+        list_sort_move(s, EL(dest, nb), a, 1);
+    } else {
+        list_sort_move(s, dest, a, na);
+    }
+    PENDING(NULL, NULL, 0);
+}
+
+// Merges the na elements at a with the nb elements that follow, with na > nb. b[nb - 1] is known
+// to belong before a[na - 1] and b[0] is known to belong at the start.
+static void list_sort_merge_hi(list_sort_t *s, mp_obj_t *a, size_t na, mp_obj_t *b, size_t nb) {
+    mp_obj_t *base_a = a;
+    mp_obj_t *base_b = list_sort_get_tmp(s, nb);
+    list_sort_move(s, base_b, b, nb);
+    // dest, a and b point at the last element of their areas.
+    mp_obj_t *dest = EL(b, nb - 1);
+    a = EL(a, na - 1);
+    b = EL(base_b, nb - 1);
+    list_sort_move(s, dest, a, 1);
+    dest = EL(dest, -1);
+    a = EL(a, -1);
+    na--;
+    mp_int_t min_gallop = s->min_gallop;
+    while (na > 0 && nb > 1) {
+        size_t a_count = 0;
+        size_t b_count = 0;
+        do {
+            PENDING(EL(dest, 1 - (mp_int_t)nb), base_b, nb);
+            if (list_sort_less(s, b, a)) {
+                list_sort_move(s, dest, a, 1);
+                a = EL(a, -1);
+                na--;
+                a_count++;
+                b_count = 0;
+            } else {
+                list_sort_move(s, dest, b, 1);
+                b = EL(b, -1);
+                nb--;
+                b_count++;
+                a_count = 0;
+            }
+            dest = EL(dest, -1);
+        } while (na > 0 && nb > 1 && a_count < (size_t)min_gallop && b_count < (size_t)min_gallop);
+        min_gallop++;
+        while (na > 0 && nb > 1) {
+            min_gallop -= min_gallop > 1;
+            s->min_gallop = min_gallop;
+            PENDING(EL(dest, 1 - (mp_int_t)nb), base_b, nb);
+            a_count = na - list_sort_gallop_right(s, b, base_a, na, na - 1);
+            dest = EL(dest, -(mp_int_t)a_count);
+            a = EL(a, -(mp_int_t)a_count);
+            list_sort_move(s, EL(dest, 1), EL(a, 1), a_count);
+            na -= a_count;
+            if (na == 0) {
+                break;
+            }
+            list_sort_move(s, dest, b, 1);
+            dest = EL(dest, -1);
+            b = EL(b, -1);
+            nb--;
+            if (nb <= 1) {
+                break;
+            }
+            PENDING(EL(dest, 1 - (mp_int_t)nb), base_b, nb);
+            b_count = nb - list_sort_gallop_left(s, a, base_b, nb, nb - 1);
+            dest = EL(dest, -(mp_int_t)b_count);
+            b = EL(b, -(mp_int_t)b_count);
+            list_sort_move(s, EL(dest, 1), EL(b, 1), b_count);
+            nb -= b_count;
+            if (nb <= 1) {
+                break;
+            }
+            list_sort_move(s, dest, a, 1);
+            dest = EL(dest, -1);
+            a = EL(a, -1);
+            na--;
+            if (a_count < LIST_SORT_MIN_GALLOP && b_count < LIST_SORT_MIN_GALLOP) {
+                min_gallop++;
+                s->min_gallop = min_gallop;
+                break;
+            }
+        }
+    }
+    if (nb == 1 && na > 0) {
+        // The first element of b belongs at the start.
+        dest = EL(dest, -(mp_int_t)na);
+        a = EL(a, -(mp_int_t)na);
+        list_sort_move(s, EL(dest, 1), EL(a, 1), na);
+        list_sort_move(s, dest, b, 1);
+    } else {
+        list_sort_move(s, EL(dest, 1 - (mp_int_t)nb), base_b, nb);
+    }
+    PENDING(NULL, NULL, 0);
+}
+
+// Merges runs i and i + 1.
+static void list_sort_merge_at(list_sort_t *s, size_t i) {
+    mp_obj_t *a = s->runs[i].base;
+    size_t na = s->runs[i].len;
+    mp_obj_t *b = s->runs[i + 1].base;
+    size_t nb = s->runs[i + 1].len;
+    s->runs[i].len = na + nb;
+    if (i == s->num_runs - 3) {
+        s->runs[i + 1] = s->runs[i + 2];
+    }
+    s->num_runs--;
+
+    // Elements of a that are not greater than b[0] and elements of b that are not less than the
+    // last of a are already in place.
+    size_t k = list_sort_gallop_right(s, b, a, na, 0);
+    a = EL(a, k);
+    na -= k;
+    if (na == 0) {
+        return;
+    }
+    nb = list_sort_gallop_left(s, EL(a, na - 1), b, nb, nb - 1);
+    if (nb == 0) {
+        return;
+    }
+    if (na <= nb) {
+        list_sort_merge_lo(s, a, na, b, nb);
+    } else {
+        list_sort_merge_hi(s, a, na, b, nb);
+    }
+}
+
+// Merges runs until the lengths of the pending runs decrease faster than the Fibonacci numbers.
+static void list_sort_merge_collapse(list_sort_t *s) {
+    list_sort_run_t *r = s->runs;
+    while (s->num_runs > 1) {
+        size_t n = s->num_runs - 2;
+        if ((n > 0 && r[n - 1].len <= r[n].len + r[n + 1].len) ||
+            (n > 1 && r[n - 2].len <= r[n - 1].len + r[n].len)) {
+            if (r[n - 1].len < r[n + 1].len) {
+                n--;
+            }
+        } else if (r[n].len > r[n + 1].len) {
+            break;
+        }
+        list_sort_merge_at(s, n);
+    }
+}
+
+static size_t list_sort_min_run(size_t n) {
+    size_t r = 0;
+    while (n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+static void list_sort_runs(list_sort_t *s, mp_obj_t *a, size_t n) {
+    size_t min_run = list_sort_min_run(n);
+    while (n > 0) {
+        size_t run = list_sort_count_run(s, a, n);
+        if (run < min_run) {
+            size_t forced = MIN(min_run, n);
+            list_sort_binary_insertion(s, a, run, forced);
+            run = forced;
+        }
+        s->runs[s->num_runs].base = a;
+        s->runs[s->num_runs].len = run;
+        s->num_runs++;
+        list_sort_merge_collapse(s);
+        a = EL(a, run);
+        n -= run;
+    }
+    while (s->num_runs > 1) {
+        size_t i = s->num_runs - 2;
+        if (i > 0 && s->runs[i - 1].len < s->runs[i + 1].len) {
+            i--;
+        }
+        list_sort_merge_at(s, i);
+    }
+}
+
+#undef EL
+#undef PENDING
+
+// Sorts n elements of width objects, comparing the first object of each.
+static void list_sort(mp_obj_t *a, size_t n, size_t width, bool reverse) {
+    list_sort_t s;
+    s.width = width;
+    s.reverse = reverse;
+    s.min_gallop = LIST_SORT_MIN_GALLOP;
+    s.tmp = NULL;
+    s.tmp_alloc = 0;
+    s.pending_len = 0;
+    s.num_runs = 0;
+
+    // Compare small ints and strs directly when all of the keys are one of them.
+    bool all_small_int = true;
+    bool all_str = true;
+    for (size_t i = 0; i < n && (all_small_int || all_str); i++) {
+        mp_obj_t key = a[i * width];
+        all_small_int = all_small_int && mp_obj_is_small_int(key);
+        all_str = all_str && mp_obj_is_str(key);
+    }
+    s.cmp = all_small_int ? LIST_SORT_CMP_SMALL_INT : all_str ? LIST_SORT_CMP_STR : LIST_SORT_CMP_OBJ;
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        list_sort_runs(&s, a, n);
+        nlr_pop();
+    } else {
+        // Put back any elements that were taken out for a merge so that none are lost.
+        if (s.pending_len > 0) {
+            memcpy(s.pending_dest, s.pending_src, s.pending_len * width * sizeof(mp_obj_t));
+        }
+        m_del(mp_obj_t, s.tmp, s.tmp_alloc);
+        nlr_jump(nlr.ret_val);
+    }
+    m_del(mp_obj_t, s.tmp, s.tmp_alloc);
+}
+
+mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_reverse, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    // parse args
+    struct {
+        mp_arg_val_t key, reverse;
+    } args;
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args,
+        MP_ARRAY_SIZE(allowed_args), allowed_args, (mp_arg_val_t *)&args);
+
+    mp_check_self(mp_obj_is_type(pos_args[0], &mp_type_list));
+    mp_obj_list_t *self = native_list(pos_args[0]);
+
+    size_t len = self->len;
+    if (len < 2) {
+        return mp_const_none;
+    }
+    if (args.key.u_obj == mp_const_none) {
+        list_sort(self->items, len, 1, args.reverse.u_bool);
+        return mp_const_none;
+    }
+
+    // Call the key function once for each item and sort the keys along with the items.
+    // The items are copied first in case the key function changes the list.
+    mp_obj_t *pairs = m_new(mp_obj_t, len * 2);
+    for (size_t i = 0; i < len; i++) {
+        pairs[i * 2 + 1] = self->items[i];
+    }
+    for (size_t i = 0; i < len; i++) {
+        pairs[i * 2] = mp_call_function_1(args.key.u_obj, pairs[i * 2 + 1]);
+    }
+    list_sort(pairs, len, 2, args.reverse.u_bool);
+    for (size_t i = 0; i < MIN(len, self->len); i++) {
+        self->items[i] = pairs[i * 2 + 1];
+    }
+    m_del(mp_obj_t, pairs, len * 2);
+    return mp_const_none;
+}
+
+#else
+
 static void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
     MP_STACK_CHECK();
     while (head < tail) {
@@ -369,6 +912,7 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
 
     return mp_const_none;
 }
+#endif
 
 // CIRCUITPY-CHANGE: used elsewhere so not static
 mp_obj_t mp_obj_list_clear(mp_obj_t self_in) {
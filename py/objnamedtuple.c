@@ -55,7 +55,7 @@ static mp_obj_t namedtuple_asdict(mp_obj_t self_in) {
     #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
     // make it an OrderedDict
     dictObj->base.type = &mp_type_ordereddict;
-    dictObj->map.is_ordered = 1;
+    dictObj->map.is_ordered = !MICROPY_OPT_COMPACT_MAP;
     #else
     dictObj->base.type = &mp_type_dict;
     dictObj->map.is_ordered = 0;
@@ -315,33 +315,102 @@ wrong_args:
     mp_raise_TypeError(MP_ERROR_TEXT("wrong number of arguments"));
 }
 
-// like strstr but with specified length and allows \0 bytes
-// TODO replace with something more efficient/standard
-const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
-    if (hlen >= nlen) {
-        size_t str_index, str_index_end;
-        if (direction > 0) {
-            str_index = 0;
-            str_index_end = hlen - nlen;
+// CIRCUITPY-CHANGE: search with memchr for the first needle byte, or with a skip table for longer
+// needles in longer haystacks.
+#define SUBBYTES_SKIP_MIN_NEEDLE (4)
+#define SUBBYTES_SKIP_MIN_HAYSTACK (64)
+
+void mp_subbytes_finder_init(mp_subbytes_finder_t *self, const byte *needle, size_t nlen, size_t hlen, int direction) {
+    self->needle = needle;
+    self->nlen = nlen;
+    self->direction = direction;
+    #if MICROPY_OPT_FAST_SUBSTRING_SEARCH
+    self->use_skip = nlen >= SUBBYTES_SKIP_MIN_NEEDLE && hlen >= SUBBYTES_SKIP_MIN_HAYSTACK;
+    if (!self->use_skip) {
+        return;
+    }
+    // The skip for a byte is how far the needle can move past the window byte furthest in the
+    // search direction. Skips are limited to 255, which is always safe.
+    size_t max_skip = MIN(nlen, 255);
+    memset(self->skip, max_skip, sizeof(self->skip));
+    if (direction > 0) {
+        for (size_t i = nlen - max_skip; i < nlen - 1; i++) {
+            self->skip[needle[i]] = nlen - 1 - i;
+        }
+    } else {
+        for (size_t i = max_skip - 1; i > 0; i--) {
+            self->skip[needle[i]] = i;
+        }
+    }
+    #endif
+}
+
+const byte *mp_subbytes_finder_find(const mp_subbytes_finder_t *self, const byte *haystack, size_t hlen) {
+    const byte *needle = self->needle;
+    size_t nlen = self->nlen;
+    if (hlen < nlen) {
+        return NULL;
+    }
+    if (nlen == 0) {
+        return self->direction > 0 ? haystack : haystack + hlen;
+    }
+    size_t last = hlen - nlen;
+
+    #if MICROPY_OPT_FAST_SUBSTRING_SEARCH
+    if (self->use_skip) {
+        if (self->direction > 0) {
+            byte last_byte = needle[nlen - 1];
+            for (size_t i = 0; i <= last;) {
+                byte b = haystack[i + nlen - 1];
+                if (b == last_byte && memcmp(haystack + i, needle, nlen - 1) == 0) {
+                    return haystack + i;
+                }
+                i += self->skip[b];
+            }
         } else {
-            str_index = hlen - nlen;
-            str_index_end = 0;
+            byte first_byte = needle[0];
+            for (size_t i = last;;) {
+                byte b = haystack[i];
+                if (b == first_byte && memcmp(haystack + i + 1, needle + 1, nlen - 1) == 0) {
+                    return haystack + i;
+                }
+                if (i < self->skip[b]) {
+                    break;
+                }
+                i -= self->skip[b];
+            }
         }
-        for (;;) {
-            if (memcmp(&haystack[str_index], needle, nlen) == 0) {
-                // found
-                return haystack + str_index;
+        return NULL;
+    }
+    #endif
+
+    byte first_byte = needle[0];
+    if (self->direction > 0) {
+        const byte *p = haystack;
+        const byte *p_last = haystack + last;
+        while (p <= p_last && (p = memchr(p, first_byte, p_last - p + 1)) != NULL) {
+            if (memcmp(p + 1, needle + 1, nlen - 1) == 0) {
+                return p;
             }
-            if (str_index == str_index_end) {
-                // not found
-                break;
+            p++;
+        }
+    } else {
+        for (size_t i = last + 1; i-- > 0;) {
+            if (haystack[i] == first_byte && memcmp(haystack + i + 1, needle + 1, nlen - 1) == 0) {
+                return haystack + i;
             }
-            str_index += direction;
         }
     }
     return NULL;
 }
 
+// like strstr but with specified length and allows \0 bytes
+const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
+    mp_subbytes_finder_t finder;
+    mp_subbytes_finder_init(&finder, needle, nlen, hlen, direction);
+    return mp_subbytes_finder_find(&finder, haystack, hlen);
+}
+
 // Note: this function is used to check if an object is a str or bytes, which
 // works because both those types use it as their binary_op method.  Revisit
 // mp_obj_is_str_or_bytes if this fact changes.
@@ -545,6 +614,12 @@ static mp_obj_t str_join(mp_obj_t self_in, mp_obj_t arg) {
         required_len += l;
     }
 
+    // CIRCUITPY-CHANGE: joining a single str or bytes gives back the same object
+    if (seq_len == 1 && (ret_type == &mp_type_str || ret_type == &mp_type_bytes)
+        && mp_obj_get_type(seq_items[0]) == ret_type) {
+        return seq_items[0];
+    }
+
     // make joined string
     vstr_t vstr;
     vstr_init_len(&vstr, required_len);
@@ -618,19 +693,15 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
             mp_raise_ValueError(MP_ERROR_TEXT("empty separator"));
         }
 
+        // CIRCUITPY-CHANGE: set up the search once for all of the separators
+        mp_subbytes_finder_t finder;
+        mp_subbytes_finder_init(&finder, (const byte *)sep_str, sep_len, top - s, 1);
         for (;;) {
             const byte *start = s;
-            for (;;) {
-                if (splits == 0 || s + sep_len > top) {
-                    s = top;
-                    break;
-                } else if (memcmp(s, sep_str, sep_len) == 0) {
-                    break;
-                }
-                s++;
-            }
+            const byte *found = splits == 0 ? NULL : mp_subbytes_finder_find(&finder, s, top - s);
+            s = found == NULL ? top : found;
             mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, start, s - start));
-            if (s >= top) {
+            if (found == NULL) {
                 break;
             }
             s += sep_len;
@@ -725,17 +796,12 @@ static mp_obj_t str_rsplit(size_t n_args, const mp_obj_t *args) {
 
         const byte *beg = s;
         const byte *last = s + len;
+        // CIRCUITPY-CHANGE: set up the search once for all of the separators
+        mp_subbytes_finder_t finder;
+        mp_subbytes_finder_init(&finder, (const byte *)sep_str, sep_len, len, -1);
         for (;;) {
-            s = last - sep_len;
-            for (;;) {
-                if (splits == 0 || s < beg) {
-                    break;
-                } else if (memcmp(s, sep_str, sep_len) == 0) {
-                    break;
-                }
-                s--;
-            }
-            if (s < beg || splits == 0) {
+            s = splits == 0 ? NULL : mp_subbytes_finder_find(&finder, beg, last - beg);
+            if (s == NULL) {
                 res->items[idx] = mp_obj_new_str_of_type(self_type, beg, last - beg);
                 break;
             }
@@ -1009,12 +1075,28 @@ static NORETURN void terse_str_format_value_error(void) {
 #define terse_str_format_value_error()
 #endif
 
+// CIRCUITPY-CHANGE
+// Bytes reserved per argument when sizing the result of formatting.
+#define STR_FORMAT_BYTES_PER_ARG (8)
+
 static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    // CIRCUITPY-CHANGE: size the result for the template and a few bytes per
+    // argument, so typical results are built without reallocating
+    vstr_init_print(&vstr, (top - str) + n_args * STR_FORMAT_BYTES_PER_ARG, &print);
 
     for (; str < top; str++) {
+        // CIRCUITPY-CHANGE: copy the text up to the next brace in one go
+        const char *text = str;
+        while (str < top && *str != '{' && *str != '}') {
+            str++;
+        }
+        vstr_add_strn(&vstr, text, str - text);
+        if (str >= top) {
+            break;
+        }
+
         if (*str == '}') {
             str++;
             if (str < top && *str == '}') {
@@ -1028,10 +1110,6 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             mp_raise_ValueError_varg(MP_ERROR_TEXT("unmatched '%c' in format"), '}');
             #endif
         }
-        if (*str != '{') {
-            vstr_add_byte(&vstr, *str);
-            continue;
-        }
 
         str++;
         if (str < top && *str == '{') {
@@ -1176,6 +1254,12 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                 assert(conversion == 'r');
                 print_kind = PRINT_REPR;
             }
+            // CIRCUITPY-CHANGE: with no format spec the result is just the
+            // str() or repr() of the argument, so print it in place
+            if (!format_spec) {
+                mp_obj_print_helper(&print, arg, print_kind);
+                continue;
+            }
             vstr_t arg_vstr;
             mp_print_t arg_print;
             vstr_init_print(&arg_vstr, 16, &arg_print);
@@ -1201,9 +1285,19 @@ static vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             // precision   ::=  integer
             // type        ::=  "b" | "c" | "d" | "e" | "E" | "f" | "F" | "g" | "G" | "n" | "o" | "s" | "x" | "X" | "%"
 
-            // recursively call the formatter to format any nested specifiers
-            MP_STACK_CHECK();
-            vstr_t format_spec_vstr = mp_obj_str_format_helper(format_spec, str, arg_i, n_args, args, kwargs);
+            // CIRCUITPY-CHANGE: a short specifier without nested fields is
+            // parsed from a copy on the stack
+            char format_spec_buf[32];
+            vstr_t format_spec_vstr;
+            size_t format_spec_len = str - format_spec;
+            if (format_spec_len < sizeof(format_spec_buf) && memchr(format_spec, '{', format_spec_len) == NULL) {
+                vstr_init_fixed_buf(&format_spec_vstr, sizeof(format_spec_buf), format_spec_buf);
+                vstr_add_strn(&format_spec_vstr, format_spec, format_spec_len);
+            } else {
+                // recursively call the formatter to format any nested specifiers
+                MP_STACK_CHECK();
+                format_spec_vstr = mp_obj_str_format_helper(format_spec, str, arg_i, n_args, args, kwargs);
+            }
             const char *s = vstr_null_terminated_str(&format_spec_vstr);
             const char *stop = s + format_spec_vstr.len;
             if (isalignment(*s)) {
@@ -1484,13 +1578,24 @@ static mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_
     size_t arg_i = 0;
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    // CIRCUITPY-CHANGE: size the result as str.format does
+    vstr_init_print(&vstr, len + n_args * STR_FORMAT_BYTES_PER_ARG, &print);
+    // CIRCUITPY-CHANGE: scratch buffer for padded or truncated %s and %r,
+    // allocated on first use and shared by all of them
+    vstr_t arg_vstr;
+    mp_print_t arg_print;
+    arg_vstr.buf = NULL;
 
     for (const byte *top = str + len; str < top; str++) {
         mp_obj_t arg = MP_OBJ_NULL;
-        if (*str != '%') {
-            vstr_add_byte(&vstr, *str);
-            continue;
+        // CIRCUITPY-CHANGE: copy the text up to the next % in one go
+        const byte *text = str;
+        while (str < top && *str != '%') {
+            str++;
+        }
+        vstr_add_strn(&vstr, (const char *)text, str - text);
+        if (str >= top) {
+            break;
         }
         if (++str >= top) {
             goto incomplete_format;
@@ -1635,25 +1740,39 @@ static mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_
 
             case 'r':
             case 's': {
-                vstr_t arg_vstr;
-                mp_print_t arg_print;
-                vstr_init_print(&arg_vstr, 16, &arg_print);
                 mp_print_kind_t print_kind = (*str == 'r' ? PRINT_REPR : PRINT_STR);
                 if (print_kind == PRINT_STR && is_bytes && mp_obj_is_type(arg, &mp_type_bytes)) {
                     // If we have something like b"%s" % b"1", bytes arg should be
                     // printed undecorated.
                     print_kind = PRINT_RAW;
                 }
-                mp_obj_print_helper(&arg_print, arg, print_kind);
-                uint vlen = arg_vstr.len;
+                // CIRCUITPY-CHANGE: print in place unless padding or truncating,
+                // and use str data directly
+                if (width == 0 && prec < 0) {
+                    mp_obj_print_helper(&print, arg, print_kind);
+                    break;
+                }
+                const char *arg_data;
+                size_t vlen;
+                if (print_kind == PRINT_STR && mp_obj_is_str(arg)) {
+                    arg_data = mp_obj_str_get_data(arg, &vlen);
+                } else {
+                    if (arg_vstr.buf == NULL) {
+                        vstr_init_print(&arg_vstr, 16, &arg_print);
+                    } else {
+                        vstr_reset(&arg_vstr);
+                    }
+                    mp_obj_print_helper(&arg_print, arg, print_kind);
+                    arg_data = arg_vstr.buf;
+                    vlen = arg_vstr.len;
+                }
                 if (prec < 0) {
                     prec = vlen;
                 }
                 if (vlen > (uint)prec) {
                     vlen = prec;
                 }
-                mp_print_strn(&print, arg_vstr.buf, vlen, flags, ' ', width);
-                vstr_clear(&arg_vstr);
+                mp_print_strn(&print, arg_data, vlen, flags, ' ', width);
                 break;
             }
 
@@ -1681,10 +1800,18 @@ static mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_
         mp_raise_TypeError(MP_ERROR_TEXT("not all arguments converted during string formatting"));
     }
 
+    // CIRCUITPY-CHANGE
+    if (arg_vstr.buf != NULL) {
+        vstr_clear(&arg_vstr);
+    }
     return mp_obj_new_str_type_from_vstr(is_bytes ? &mp_type_bytes : &mp_type_str, &vstr);
 }
 #endif
 
+// CIRCUITPY-CHANGE
+// How many match positions str_replace keeps from its first pass.
+#define STR_REPLACE_REMEMBERED_MATCHES (16)
+
 // The implementation is optimized, returning the original string if there's
 // nothing to replace.
 static mp_obj_t str_replace(size_t n_args, const mp_obj_t *args) {
@@ -1724,6 +1851,13 @@ static mp_obj_t str_replace(size_t n_args, const mp_obj_t *args) {
     byte *data = NULL;
     vstr_t vstr;
 
+    // CIRCUITPY-CHANGE: set up the search once, and remember the first matches so that the second
+    // pass only copies
+    mp_subbytes_finder_t finder;
+    mp_subbytes_finder_init(&finder, old, old_len, str_len, 1);
+    const byte *matches[STR_REPLACE_REMEMBERED_MATCHES];
+    size_t num_matches_remembered = 0;
+
     // do 2 passes over the string:
     //   first pass computes the required length of the replaced string
     //   second pass does the replacements
@@ -1733,6 +1867,7 @@ static mp_obj_t str_replace(size_t n_args, const mp_obj_t *args) {
         const byte *old_occurrence;
         const byte *offset_ptr = str;
         size_t str_len_remain = str_len;
+        size_t num_matches = 0;
         if (old_len == 0) {
             // if old_str is empty, copy new_str to start of replaced string
             // copy the replacement string
@@ -1742,7 +1877,19 @@ static mp_obj_t str_replace(size_t n_args, const mp_obj_t *args) {
             replaced_str_index += new_len;
             num_replacements_done++;
         }
-        while (num_replacements_done != (size_t)max_rep && str_len_remain > 0 && (old_occurrence = find_subbytes(offset_ptr, str_len_remain, old, old_len, 1)) != NULL) {
+        while (num_replacements_done != (size_t)max_rep && str_len_remain > 0) {
+            if (data != NULL && num_matches < num_matches_remembered) {
+                old_occurrence = matches[num_matches];
+            } else {
+                old_occurrence = mp_subbytes_finder_find(&finder, offset_ptr, str_len_remain);
+                if (old_occurrence == NULL) {
+                    break;
+                }
+                if (data == NULL && num_matches < STR_REPLACE_REMEMBERED_MATCHES) {
+                    matches[num_matches_remembered++] = old_occurrence;
+                }
+            }
+            num_matches++;
             if (old_len == 0) {
                 old_occurrence += 1;
             }
@@ -1813,17 +1960,16 @@ static mp_obj_t str_count(size_t n_args, const mp_obj_t *args) {
         return MP_OBJ_NEW_SMALL_INT(utf8_charlen(start, end - start) + 1);
     }
 
-    bool is_str = self_type == &mp_type_str;
-
     // count the occurrences
+    // CIRCUITPY-CHANGE: set up the search once. A match of valid UTF-8 always starts on a character
+    // boundary so there is no need to step by characters.
     mp_int_t num_occurrences = 0;
-    for (const byte *haystack_ptr = start; haystack_ptr + needle_len <= end;) {
-        if (memcmp(haystack_ptr, needle, needle_len) == 0) {
-            num_occurrences++;
-            haystack_ptr += needle_len;
-        } else {
-            haystack_ptr = is_str ? utf8_next_char(haystack_ptr) : haystack_ptr + 1;
-        }
+    mp_subbytes_finder_t finder;
+    mp_subbytes_finder_init(&finder, needle, needle_len, end - start, 1);
+    for (const byte *haystack_ptr = start;
+         (haystack_ptr = mp_subbytes_finder_find(&finder, haystack_ptr, end - haystack_ptr)) != NULL;
+         haystack_ptr += needle_len) {
+        num_occurrences++;
     }
 
     return MP_OBJ_NEW_SMALL_INT(num_occurrences);
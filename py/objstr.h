@@ -104,6 +104,23 @@ const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, s
     mp_obj_t index, bool is_slice);
 const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction);
 
+// CIRCUITPY-CHANGE
+// Searches for the same needle repeatedly, such as for split or replace, without redoing the
+// setup each time. hlen is the total length that will be searched and direction is 1 to find
+// the first match or -1 to find the last one.
+typedef struct _mp_subbytes_finder_t {
+    const byte *needle;
+    size_t nlen;
+    int direction;
+    #if MICROPY_OPT_FAST_SUBSTRING_SEARCH
+    bool use_skip;
+    byte skip[256];
+    #endif
+} mp_subbytes_finder_t;
+
+void mp_subbytes_finder_init(mp_subbytes_finder_t *self, const byte *needle, size_t nlen, size_t hlen, int direction);
+const byte *mp_subbytes_finder_find(const mp_subbytes_finder_t *self, const byte *haystack, size_t hlen);
+
 #define MP_DEFINE_BYTES_OBJ(obj_name, target, len) mp_obj_str_t obj_name = {{&mp_type_bytes}, 0, (len), (const byte *)(target)}
 
 mp_obj_t mp_obj_bytes_hex(size_t n_args, const mp_obj_t *args, const mp_obj_type_t *type);
@@ -157,6 +157,10 @@ static mp_uint_t stringio_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
             s->offset = o->pos = new_pos;
             return 0;
         }
+        // CIRCUITPY-CHANGE
+        case MP_STREAM_GET_FILESIZE:
+            check_stringio_is_open(o);
+            return o->vstr->len;
         case MP_STREAM_FLUSH:
             return 0;
         case MP_STREAM_CLOSE:
@@ -253,6 +257,8 @@ static const mp_stream_p_t stringio_stream_p = {
     .write = stringio_write,
     .ioctl = stringio_ioctl,
     .is_text = true,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -270,6 +276,8 @@ static const mp_stream_p_t bytesio_stream_p = {
     .read = stringio_read,
     .write = stringio_write,
     .ioctl = stringio_ioctl,
+    // CIRCUITPY-CHANGE
+    .seekable_readahead = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -9,6 +9,9 @@
 // CIRCUITPY-CHANGE: API and implementation thoroughly reworked
 // No attempt to have atomic operations. Add guards if atomicity required.
 
+#include <string.h>
+
+#include "py/misc.h"
 #include "ringbuf.h"
 
 bool ringbuf_init(ringbuf_t *r, uint8_t *buf, size_t size) {
@@ -103,24 +106,71 @@ size_t ringbuf_num_filled(ringbuf_t *r) {
 // If the ring buffer fills up, not all bytes will be written.
 // Returns how many bytes were successfully written.
 size_t ringbuf_put_n(ringbuf_t *r, const uint8_t *buf, size_t bufsize) {
-    for (size_t i = 0; i < bufsize; i++) {
-        if (ringbuf_put(r, buf[i]) < 0) {
+    size_t written = 0;
+    // At most two contiguous segments: up to the end of the buffer, then from the start.
+    while (written < bufsize) {
+        size_t len;
+        uint8_t *dest = ringbuf_peek_write(r, &len);
+        if (len == 0) {
             // If ringbuf is full, give up and return how many bytes
             // we wrote so far.
-            return i;
+            break;
         }
+        len = MIN(len, bufsize - written);
+        memcpy(dest, buf + written, len);
+        ringbuf_commit_write(r, len);
+        written += len;
     }
-    return bufsize;
+    return written;
 }
 
 // Returns how many bytes were fetched.
 size_t ringbuf_get_n(ringbuf_t *r, uint8_t *buf, size_t bufsize) {
-    for (size_t i = 0; i < bufsize; i++) {
-        int b = ringbuf_get(r);
-        if (b < 0) {
-            return i;
+    size_t fetched = 0;
+    while (fetched < bufsize) {
+        size_t len;
+        const uint8_t *src = ringbuf_peek_read(r, &len);
+        if (len == 0) {
+            break;
         }
-        buf[i] = b;
+        len = MIN(len, bufsize - fetched);
+        memcpy(buf + fetched, src, len);
+        ringbuf_commit_read(r, len);
+        fetched += len;
+    }
+    return fetched;
+}
+
+// Zero-copy access for consumers. Returns a pointer to the next byte to read and sets
+// *len to the number of bytes that can be read from it without wrapping around.
+// *len is 0 if the ringbuf is empty. Follow with ringbuf_commit_read().
+const uint8_t *ringbuf_peek_read(ringbuf_t *r, size_t *len) {
+    *len = MIN(r->used, r->size - r->next_read);
+    return r->buf + r->next_read;
+}
+
+// Mark len bytes as consumed. len must not exceed the length returned by ringbuf_peek_read().
+void ringbuf_commit_read(ringbuf_t *r, size_t len) {
+    r->next_read += len;
+    if (r->next_read >= r->size) {
+        r->next_read -= r->size;
+    }
+    r->used -= len;
+}
+
+// Zero-copy access for producers such as DMA or interrupt handlers. Returns a pointer to the
+// next free byte and sets *len to the number of bytes that can be written to it without
+// wrapping around. *len is 0 if the ringbuf is full. Follow with ringbuf_commit_write().
+uint8_t *ringbuf_peek_write(ringbuf_t *r, size_t *len) {
+    *len = MIN(r->size - r->used, r->size - r->next_write);
+    return r->buf + r->next_write;
+}
+
+// Mark len bytes as filled. len must not exceed the length returned by ringbuf_peek_write().
+void ringbuf_commit_write(ringbuf_t *r, size_t len) {
+    r->next_write += len;
+    if (r->next_write >= r->size) {
+        r->next_write -= r->size;
     }
-    return bufsize;
+    r->used += len;
 }
@@ -41,6 +41,13 @@ size_t ringbuf_num_filled(ringbuf_t *r);
 size_t ringbuf_put_n(ringbuf_t *r, const uint8_t *buf, size_t bufsize);
 size_t ringbuf_get_n(ringbuf_t *r, uint8_t *buf, size_t bufsize);
 
+// Zero-copy access to the largest contiguous readable or writable region.
+// Call the matching commit function afterwards with the number of bytes actually used.
+const uint8_t *ringbuf_peek_read(ringbuf_t *r, size_t *len);
+void ringbuf_commit_read(ringbuf_t *r, size_t len);
+uint8_t *ringbuf_peek_write(ringbuf_t *r, size_t *len);
+void ringbuf_commit_write(ringbuf_t *r, size_t len);
+
 // Note: big-endian. Return -1 if can't read or write two bytes.
 int ringbuf_get16(ringbuf_t *r);
 int ringbuf_put16(ringbuf_t *r, uint16_t v);
@@ -101,6 +101,11 @@ void mp_init(void) {
 
     mp_obj_exception_initialize0(&MP_STATE_VM(mp_reload_exception), &mp_type_ReloadException);
 
+    // CIRCUITPY-CHANGE: forget bound methods left in a previous heap
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    memset(MP_STATE_VM(bound_meth_cache), 0, sizeof(MP_STATE_VM(bound_meth_cache)));
+    #endif
+
     // call port specific initialization if any
     #ifdef MICROPY_PORT_INIT_FUNC
     MICROPY_PORT_INIT_FUNC;
@@ -140,6 +145,11 @@ void mp_init(void) {
     }
     #endif
 
+    // CIRCUITPY-CHANGE: forget patterns compiled on the previous heap
+    #if MICROPY_PY_RE && MICROPY_PY_RE_CACHE_SIZE > 0
+    memset(MP_STATE_VM(re_cache), 0, sizeof(MP_STATE_VM(re_cache)));
+    #endif
+
     // CIRCUITPY-CHANGE: do not unmount /
     #if MICROPY_VFS && 0
     // initialise the VFS sub-system
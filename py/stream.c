@@ -37,6 +37,8 @@
 
 // TODO: should be in mpconfig.h
 #define DEFAULT_BUFFER_SIZE 256
+// CIRCUITPY-CHANGE: chunk size used by readline() on seekable streams
+#define READLINE_LOOKAHEAD_SIZE 64
 
 static mp_obj_t stream_readall(mp_obj_t self_in);
 
@@ -314,14 +316,40 @@ static mp_obj_t stream_readinto(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream_readinto_obj, 2, 3, stream_readinto);
 
+// CIRCUITPY-CHANGE: size hint so readall() can allocate its result in one go
+// Returns the number of bytes left until the end of the stream, or 0 if unknown.
+static mp_uint_t stream_remaining_size(mp_obj_t self_in, const mp_stream_p_t *stream_p) {
+    if (!stream_p->seekable_readahead) {
+        return 0;
+    }
+    int error;
+    mp_uint_t size = stream_p->ioctl(self_in, MP_STREAM_GET_FILESIZE, 0, &error);
+    if (size == MP_STREAM_ERROR) {
+        return 0;
+    }
+    mp_off_t pos = mp_stream_seek(self_in, 0, MP_SEEK_CUR, &error);
+    if (pos == (mp_off_t)-1 || (mp_uint_t)pos >= size) {
+        return 0;
+    }
+    return size - (mp_uint_t)pos;
+}
+
 static mp_obj_t stream_readall(mp_obj_t self_in) {
     const mp_stream_p_t *stream_p = mp_get_stream(self_in);
 
+    // CIRCUITPY-CHANGE: If the remaining size is known, read it all at once. The extra
+    // byte leaves room to detect EOF and for the terminating null, so no realloc is needed.
+    mp_uint_t current_read = stream_remaining_size(self_in, stream_p);
+    if (current_read == 0) {
+        current_read = DEFAULT_BUFFER_SIZE;
+    } else {
+        current_read += 1;
+    }
+
     mp_uint_t total_size = 0;
     vstr_t vstr;
-    vstr_init(&vstr, DEFAULT_BUFFER_SIZE);
+    vstr_init(&vstr, current_read);
     char *p = vstr.buf;
-    mp_uint_t current_read = DEFAULT_BUFFER_SIZE;
     while (true) {
         int error;
         mp_uint_t out_sz = stream_p->read(self_in, p, current_read, &error);
@@ -358,6 +386,47 @@ static mp_obj_t stream_readall(mp_obj_t self_in) {
     }
 }
 
+// CIRCUITPY-CHANGE: readline() for seekable streams. Reads a chunk at a time, scans it
+// for the newline and then seeks back over whatever was read past it.
+// Returns false without reading anything if the stream position can't be determined.
+static bool stream_lookahead_readline(mp_obj_t self_in, const mp_stream_p_t *stream_p, mp_int_t max_size, vstr_t *vstr) {
+    int error;
+    if (mp_stream_seek(self_in, 0, MP_SEEK_CUR, &error) == (mp_off_t)-1) {
+        return false;
+    }
+
+    while (max_size == -1 || max_size != 0) {
+        mp_uint_t chunk = READLINE_LOOKAHEAD_SIZE;
+        if (max_size != -1 && (mp_uint_t)max_size < chunk) {
+            chunk = max_size;
+        }
+        char *p = vstr_add_len(vstr, chunk);
+        mp_uint_t out_sz = stream_p->read(self_in, p, chunk, &error);
+        if (out_sz == MP_STREAM_ERROR) {
+            vstr_cut_tail_bytes(vstr, chunk);
+            mp_raise_OSError(error);
+        }
+        char *nl = memchr(p, '\n', out_sz);
+        if (nl != NULL) {
+            mp_uint_t used = nl - p + 1;
+            vstr_cut_tail_bytes(vstr, chunk - used);
+            if (used < out_sz && mp_stream_seek(self_in, -(mp_off_t)(out_sz - used), MP_SEEK_CUR, &error) == (mp_off_t)-1) {
+                mp_raise_OSError(error);
+            }
+            break;
+        }
+        vstr_cut_tail_bytes(vstr, chunk - out_sz);
+        if (out_sz < chunk) {
+            // EOF
+            break;
+        }
+        if (max_size != -1) {
+            max_size -= out_sz;
+        }
+    }
+    return true;
+}
+
 // Unbuffered, inefficient implementation of readline() for raw I/O files.
 static mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args) {
     const mp_stream_p_t *stream_p = mp_get_stream(args[0]);
@@ -374,6 +443,11 @@ static mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args)
         vstr_init(&vstr, 16);
     }
 
+    // CIRCUITPY-CHANGE
+    if (stream_p->seekable_readahead && stream_lookahead_readline(args[0], stream_p, max_size, &vstr)) {
+        goto return_line;
+    }
+
     while (max_size == -1 || max_size-- != 0) {
         char *p = vstr_add_len(&vstr, 1);
         int error;
@@ -408,6 +482,7 @@ static mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args)
         }
     }
 
+return_line:
     if (stream_p->is_text) {
         return mp_obj_new_str_from_vstr(&vstr);
     } else {
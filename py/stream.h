@@ -46,6 +46,8 @@
 #define MP_STREAM_SET_DATA_OPTS (9)  // Set data/message options
 #define MP_STREAM_GET_FILENO    (10) // Get fileno of underlying file
 #define MP_STREAM_GET_BUFFER_SIZE (11) // Get preferred buffer size for file
+// CIRCUITPY-CHANGE
+#define MP_STREAM_GET_FILESIZE  (12) // Get total size of file, if known
 
 // These poll ioctl values are compatible with Linux
 #define MP_STREAM_POLL_RD       (0x0001)
@@ -82,6 +84,9 @@ typedef struct _mp_stream_p_t {
     bool pyserial_readinto_compatibility : 1;         // Disallow size parameter in readinto()
     bool pyserial_read_compatibility : 1;             // Disallow omitting read(size) size parameter
     bool pyserial_dont_return_none_compatibility : 1; // Don't return None for read() or readinto()
+    // CIRCUITPY-CHANGE: set for file-like streams where seek is cheap and MP_STREAM_GET_FILESIZE
+    // is supported. readline() then reads ahead and seeks back, and readall() allocates once.
+    bool seekable_readahead : 1;
 } mp_stream_p_t;
 
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream_read_obj);
@@ -14,11 +14,16 @@
 #include "py/runtime.h"
 #include "py/gc.h"
 
+#include <math.h>
 #include <string.h>
 
 #include "shared-bindings/adafruit_pixelbuf/PixelBuf.h"
 #include "shared-module/adafruit_pixelbuf/PixelBuf.h"
-#include "shared-bindings/digitalio/DigitalInOut.h"
+
+#if CIRCUITPY_DISPLAYIO || CIRCUITPY_DISPLAYIO_UNIX
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-module/displayio/Bitmap.h"
+#endif
 
 #if CIRCUITPY_ULAB
 #include "extmod/ulab/code/ndarray.h"
@@ -29,6 +34,7 @@ static NORETURN void invalid_byteorder(void) {
 }
 
 static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t *parsed);
+static void parse_buffer_format(mp_obj_t format_obj, pixelbuf_byteorder_details_t *parsed);
 
 //| class PixelBuf:
 //|     """A fast RGB[W] pixel buffer for LED and similar devices."""
@@ -65,7 +71,7 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
 static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_size, ARG_byteorder, ARG_brightness, ARG_auto_write, ARG_header, ARG_trailer };
     static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
         { MP_QSTR_byteorder, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_BGR) } },
         { MP_QSTR_brightness, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
         { MP_QSTR_auto_write, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
@@ -90,7 +96,7 @@ static mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         trailer_bufinfo.len = 0;
     }
 
-    float brightness = 1.0;
+    mp_float_t brightness = 1.0;
     if (args[ARG_brightness].u_obj != mp_const_none) {
         brightness = mp_obj_get_float(args[ARG_brightness].u_obj);
         if (brightness < 0) {
@@ -144,6 +150,65 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
     }
 }
 
+// Like parse_byteorder but also accepts X for an unused byte and RGB565, which is flagged by a
+// bpp of 2.
+static void parse_buffer_format(mp_obj_t format_obj, pixelbuf_byteorder_details_t *parsed) {
+    mp_arg_validate_type_string(format_obj, MP_QSTR_format);
+
+    size_t len;
+    const char *format = mp_obj_str_get_data(format_obj, &len);
+    memset(parsed, 0, sizeof(*parsed));
+    parsed->order_string = format_obj;
+    if (len == 6 && memcmp(format, "RGB565", 6) == 0) {
+        parsed->bpp = 2;
+        return;
+    }
+    if (len < 3 || len > 4) {
+        mp_arg_error_invalid(MP_QSTR_format);
+    }
+    parsed->bpp = len;
+    bool seen[4] = { false, false, false, false };
+    for (size_t i = 0; i < len; i++) {
+        uint8_t *channel;
+        switch (format[i]) {
+            case 'R':
+                channel = &parsed->byteorder.r;
+                break;
+            case 'G':
+                channel = &parsed->byteorder.g;
+                break;
+            case 'B':
+                channel = &parsed->byteorder.b;
+                break;
+            case 'W':
+                parsed->has_white = true;
+                channel = &parsed->byteorder.w;
+                break;
+            case 'P':
+                // The dotstar brightness byte is always first.
+                if (i != 0) {
+                    mp_arg_error_invalid(MP_QSTR_format);
+                }
+                parsed->is_dotstar = true;
+                channel = &parsed->byteorder.w;
+                break;
+            case 'X':
+                continue;
+            default:
+                mp_arg_error_invalid(MP_QSTR_format);
+        }
+        size_t c = channel - &parsed->byteorder.r;
+        if (seen[c]) {
+            mp_arg_error_invalid(MP_QSTR_format);
+        }
+        seen[c] = true;
+        *channel = i;
+    }
+    if (!(seen[PIXEL_R] && seen[PIXEL_G] && seen[PIXEL_B])) {
+        mp_arg_error_invalid(MP_QSTR_format);
+    }
+}
+
 //|     bpp: int
 //|     """The number of bytes per pixel in the buffer (read-only)"""
 static mp_obj_t pixelbuf_pixelbuf_obj_get_bpp(mp_obj_t self_in) {
@@ -211,6 +276,33 @@ MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_get_byteorder_str, pixelbuf_pixelbuf
 MP_PROPERTY_GETTER(pixelbuf_pixelbuf_byteorder_str,
     (mp_obj_t)&pixelbuf_pixelbuf_get_byteorder_str);
 
+//|     gamma_table: Optional[ReadableBuffer]
+//|     """A 256 entry lookup table applied to every color value, or None. The table is combined
+//|     with `brightness` and applied once per frame by `show`, so setting pixels doesn't scale them
+//|     individually. Reading it returns a copy of the table."""
+//|
+static mp_obj_t pixelbuf_pixelbuf_obj_get_gamma_table(mp_obj_t self_in) {
+    return common_hal_adafruit_pixelbuf_pixelbuf_get_gamma_table(self_in);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_get_gamma_table_obj, pixelbuf_pixelbuf_obj_get_gamma_table);
+
+static mp_obj_t pixelbuf_pixelbuf_obj_set_gamma_table(mp_obj_t self_in, mp_obj_t value) {
+    const uint8_t *table = NULL;
+    if (value != mp_const_none) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(value, &bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length(bufinfo.len, 256, MP_QSTR_gamma_table);
+        table = bufinfo.buf;
+    }
+    common_hal_adafruit_pixelbuf_pixelbuf_set_gamma_table(self_in, table);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_set_gamma_table_obj, pixelbuf_pixelbuf_obj_set_gamma_table);
+
+MP_PROPERTY_GETSET(pixelbuf_pixelbuf_gamma_table_obj,
+    (mp_obj_t)&pixelbuf_pixelbuf_get_gamma_table_obj,
+    (mp_obj_t)&pixelbuf_pixelbuf_set_gamma_table_obj);
+
 static mp_obj_t pixelbuf_pixelbuf_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     switch (op) {
         case MP_UNARY_OP_BOOL:
@@ -246,6 +338,245 @@ static mp_obj_t pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t value) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_fill);
 
+//|     def set_from_buffer(self, buffer: ReadableBuffer, format: Optional[str] = None) -> None:
+//|         """Sets pixels from packed color data in ``buffer``, starting with the first pixel. This
+//|         is much faster than assigning a sequence of colors because the data is copied in a single
+//|         pass without creating an object per pixel.
+//|
+//|         ``format`` describes the bytes of each pixel in ``buffer``. It is a byteorder string (such
+//|         as "RGB", "GRBW" or "PBGR") that may also use ``X`` for a byte that is skipped, or
+//|         "RGB565" for little endian 16 bit values. The default is the `byteorder` of this object, in
+//|         which case the data is copied as is.
+//|
+//|         ``buffer`` may also be a `displayio.Bitmap` whose values are the size of one pixel in
+//|         ``format``, such as a 16 bit one holding RGB565 colors with "RGB565". Its rows are copied
+//|         one after another, skipping the padding at the end of each row.
+//|
+//|         No white is derived from RGB data and RGB data sets the full per-pixel brightness of
+//|         DotStar pixels.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer buffer: Packed color data or a `displayio.Bitmap` for up to ``len(self)`` pixels
+//|         :param str format: Byte order of ``buffer``
+//|         """
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_set_from_buffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_format };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_format, MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t self_in = pos_args[0];
+
+    pixelbuf_byteorder_details_t format;
+    mp_obj_t format_obj = args[ARG_format].u_obj;
+    if (format_obj == mp_const_none) {
+        format_obj = common_hal_adafruit_pixelbuf_pixelbuf_get_byteorder_string(self_in);
+    }
+    parse_buffer_format(format_obj, &format);
+
+    mp_obj_t buffer_obj = args[ARG_buffer].u_obj;
+    const uint8_t *buf;
+    size_t row_length, rows, stride;
+    #if CIRCUITPY_DISPLAYIO || CIRCUITPY_DISPLAYIO_UNIX
+    if (mp_obj_is_type(buffer_obj, &displayio_bitmap_type)) {
+        // Bitmap rows are padded to whole words so they can't be treated as one packed run.
+        displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(buffer_obj);
+        if (bitmap->bits_per_value != format.bpp * 8) {
+            mp_arg_error_invalid(MP_QSTR_buffer);
+        }
+        buf = (const uint8_t *)bitmap->data;
+        row_length = bitmap->width;
+        rows = bitmap->height;
+        stride = bitmap->stride * sizeof(uint32_t);
+    } else
+    #endif
+    {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
+        if (bufinfo.len % format.bpp != 0) {
+            mp_arg_error_invalid(MP_QSTR_buffer);
+        }
+        buf = bufinfo.buf;
+        row_length = bufinfo.len / format.bpp;
+        rows = 1;
+        stride = bufinfo.len;
+    }
+    mp_arg_validate_length_max(row_length * rows, common_hal_adafruit_pixelbuf_pixelbuf_get_len(self_in), MP_QSTR_buffer);
+
+    common_hal_adafruit_pixelbuf_pixelbuf_set_from_buffer(self_in, buf, row_length, rows, stride, &format);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(pixelbuf_pixelbuf_set_from_buffer_obj, 2, pixelbuf_pixelbuf_set_from_buffer);
+
+//|     def fill_gradient(
+//|         self, start_color: PixelType, end_color: PixelType, start: int = 0, stop: Optional[int] = None
+//|     ) -> None:
+//|         """Fills pixels ``start`` to ``stop - 1`` with a linear gradient from ``start_color`` to
+//|         ``end_color``. By default the whole buffer is filled."""
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_fill_gradient(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_start_color, ARG_end_color, ARG_start, ARG_stop };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_start_color, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_end_color, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_stop, MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t self_in = pos_args[0];
+
+    mp_int_t length = common_hal_adafruit_pixelbuf_pixelbuf_get_len(self_in);
+    mp_int_t stop = length;
+    if (args[ARG_stop].u_obj != mp_const_none) {
+        stop = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_stop].u_obj), 0, length, MP_QSTR_stop);
+    }
+    mp_int_t start = mp_arg_validate_int_range(args[ARG_start].u_int, 0, stop, MP_QSTR_start);
+
+    common_hal_adafruit_pixelbuf_pixelbuf_fill_gradient(self_in, args[ARG_start_color].u_obj,
+        args[ARG_end_color].u_obj, start, stop);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(pixelbuf_pixelbuf_fill_gradient_obj, 3, pixelbuf_pixelbuf_fill_gradient);
+
+//|     def fill_palette(self, palette: ReadableBuffer, offset: int = 0, *, format: Optional[str] = None) -> None:
+//|         """Fills the buffer by repeating the packed colors in ``palette``, starting with entry
+//|         ``offset``. Increasing ``offset`` on each frame cycles the palette along the pixels.
+//|         ``format`` is the same as for `set_from_buffer`."""
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_fill_palette(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_palette, ARG_offset, ARG_format };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_palette, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_format, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t self_in = pos_args[0];
+
+    pixelbuf_byteorder_details_t format;
+    mp_obj_t format_obj = args[ARG_format].u_obj;
+    if (format_obj == mp_const_none) {
+        format_obj = common_hal_adafruit_pixelbuf_pixelbuf_get_byteorder_string(self_in);
+    }
+    parse_buffer_format(format_obj, &format);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_palette].u_obj, &bufinfo, MP_BUFFER_READ);
+    size_t entries = bufinfo.len / format.bpp;
+    if (entries == 0 || entries * format.bpp != bufinfo.len) {
+        mp_arg_error_invalid(MP_QSTR_palette);
+    }
+    mp_int_t offset = args[ARG_offset].u_int % (mp_int_t)entries;
+    if (offset < 0) {
+        offset += entries;
+    }
+
+    common_hal_adafruit_pixelbuf_pixelbuf_fill_palette(self_in, bufinfo.buf, entries, &format, offset);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(pixelbuf_pixelbuf_fill_palette_obj, 2, pixelbuf_pixelbuf_fill_palette);
+
+#if CIRCUITPY_RAINBOWIO
+//|     def fill_rainbow(self, offset: float = 0, repeat: float = 1) -> None:
+//|         """Fills the buffer with ``repeat`` cycles of the `rainbowio.colorwheel`, starting at
+//|         color wheel position ``offset``. Increasing ``offset`` on each frame moves the rainbow
+//|         along the pixels."""
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_fill_rainbow(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_offset, ARG_repeat };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_offset, MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_SMALL_INT(0) } },
+        { MP_QSTR_repeat, MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_SMALL_INT(1) } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t offset = mp_obj_get_float(args[ARG_offset].u_obj);
+    if (offset < 0) {
+        offset = 256 - MICROPY_FLOAT_C_FUN(fmod)(-offset, 256);
+    }
+    mp_float_t repeat = mp_arg_validate_obj_float_non_negative(args[ARG_repeat].u_obj, 1, MP_QSTR_repeat);
+
+    common_hal_adafruit_pixelbuf_pixelbuf_fill_rainbow(pos_args[0], offset, repeat);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(pixelbuf_pixelbuf_fill_rainbow_obj, 1, pixelbuf_pixelbuf_fill_rainbow);
+#endif
+
+//|     def fade(self, factor: float) -> None:
+//|         """Scales every pixel's color by ``factor`` (0 to 1.0). Calling this once per frame before
+//|         drawing new pixels leaves fading trails. DotStar per-pixel brightness is unchanged."""
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_fade(mp_obj_t self_in, mp_obj_t factor_in) {
+    mp_float_t factor = mp_arg_validate_obj_float_range(factor_in, 0, 1, MP_QSTR_factor);
+    common_hal_adafruit_pixelbuf_pixelbuf_fade(self_in, factor);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fade_obj, pixelbuf_pixelbuf_fade);
+
+//|     def blend(self, a: PixelBuf, b: PixelBuf, amount: float) -> None:
+//|         """Sets every pixel to a mix of the pixels in ``a`` and ``b``, which must have the same
+//|         length and byteorder as this buffer. ``amount`` of 0 gives ``a`` and 1.0 gives ``b``;
+//|         stepping it over several frames crossfades between two frames rendered off screen.
+//|         Either source may be this buffer."""
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_blend(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t self_in = args[0];
+    size_t length = common_hal_adafruit_pixelbuf_pixelbuf_get_len(self_in);
+    mp_obj_t byteorder = common_hal_adafruit_pixelbuf_pixelbuf_get_byteorder_string(self_in);
+    const qstr source_names[] = { MP_QSTR_a, MP_QSTR_b };
+    for (size_t i = 0; i < 2; i++) {
+        mp_obj_t source = args[i + 1];
+        if (mp_obj_cast_to_native_base(source, &pixelbuf_pixelbuf_type) == MP_OBJ_NULL) {
+            mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, not %q"),
+                source_names[i], MP_QSTR_PixelBuf, mp_obj_get_type_qstr(source));
+        }
+        mp_arg_validate_length(common_hal_adafruit_pixelbuf_pixelbuf_get_len(source), length, source_names[i]);
+        if (!mp_obj_equal(common_hal_adafruit_pixelbuf_pixelbuf_get_byteorder_string(source), byteorder)) {
+            mp_arg_error_invalid(MP_QSTR_byteorder);
+        }
+    }
+    mp_float_t amount = mp_arg_validate_obj_float_range(args[3], 0, 1, MP_QSTR_amount);
+
+    common_hal_adafruit_pixelbuf_pixelbuf_blend(self_in, args[1], args[2], amount);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(pixelbuf_pixelbuf_blend_obj, 4, 4, pixelbuf_pixelbuf_blend);
+
+#if CIRCUITPY_RANDOM || MICROPY_PY_RANDOM
+//|     def sparkle(self, color: PixelType, count: int = 1) -> None:
+//|         """Sets ``count`` randomly chosen pixels to ``color``, using the `random` module's
+//|         generator. Combine with `fade` for twinkling effects."""
+//|         ...
+//|
+
+static mp_obj_t pixelbuf_pixelbuf_sparkle(size_t n_args, const mp_obj_t *args) {
+    mp_int_t count = 1;
+    if (n_args > 2) {
+        count = mp_arg_validate_int_min(mp_obj_get_int(args[2]), 0, MP_QSTR_count);
+    }
+    common_hal_adafruit_pixelbuf_pixelbuf_sparkle(args[0], args[1], count);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(pixelbuf_pixelbuf_sparkle_obj, 2, 3, pixelbuf_pixelbuf_sparkle);
+#endif
+
 //|     @overload
 //|     def __getitem__(self, index: slice) -> PixelReturnSequence:
 //|         """Returns the pixel value at the given index as a tuple of (Red, Green, Blue[, White]) values
@@ -349,8 +680,20 @@ static const mp_rom_map_elem_t pixelbuf_pixelbuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_bpp), MP_ROM_PTR(&pixelbuf_pixelbuf_bpp_obj)},
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&pixelbuf_pixelbuf_brightness_obj)},
     { MP_ROM_QSTR(MP_QSTR_byteorder), MP_ROM_PTR(&pixelbuf_pixelbuf_byteorder_str)},
+    { MP_ROM_QSTR(MP_QSTR_gamma_table), MP_ROM_PTR(&pixelbuf_pixelbuf_gamma_table_obj)},
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&pixelbuf_pixelbuf_show_obj)},
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_obj)},
+    { MP_ROM_QSTR(MP_QSTR_set_from_buffer), MP_ROM_PTR(&pixelbuf_pixelbuf_set_from_buffer_obj)},
+    { MP_ROM_QSTR(MP_QSTR_fill_gradient), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_gradient_obj)},
+    { MP_ROM_QSTR(MP_QSTR_fill_palette), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_palette_obj)},
+    #if CIRCUITPY_RAINBOWIO
+    { MP_ROM_QSTR(MP_QSTR_fill_rainbow), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_rainbow_obj)},
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_fade), MP_ROM_PTR(&pixelbuf_pixelbuf_fade_obj)},
+    { MP_ROM_QSTR(MP_QSTR_blend), MP_ROM_PTR(&pixelbuf_pixelbuf_blend_obj)},
+    #if CIRCUITPY_RANDOM || MICROPY_PY_RANDOM
+    { MP_ROM_QSTR(MP_QSTR_sparkle), MP_ROM_PTR(&pixelbuf_pixelbuf_sparkle_obj)},
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(pixelbuf_pixelbuf_locals_dict, pixelbuf_pixelbuf_locals_dict_table);
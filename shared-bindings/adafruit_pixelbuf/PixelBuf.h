@@ -36,4 +36,14 @@ mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_pixel(mp_obj_t self, size_t i
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel(mp_obj_t self, size_t index, mp_obj_t item);
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, mp_obj_t *values, mp_obj_tuple_t *flatten_to);
 void common_hal_adafruit_pixelbuf_pixelbuf_parse_color(mp_obj_t self, mp_obj_t color, uint8_t *r, uint8_t *g, uint8_t *b, uint8_t *w);
+void common_hal_adafruit_pixelbuf_pixelbuf_set_from_buffer(mp_obj_t self, const uint8_t *buf, size_t row_length, size_t rows,
+    size_t stride, const pixelbuf_byteorder_details_t *format);
+void common_hal_adafruit_pixelbuf_pixelbuf_fill_gradient(mp_obj_t self, mp_obj_t start_color, mp_obj_t end_color, size_t start, size_t stop);
+void common_hal_adafruit_pixelbuf_pixelbuf_fill_palette(mp_obj_t self, const uint8_t *palette, size_t entries, const pixelbuf_byteorder_details_t *format, size_t offset);
+void common_hal_adafruit_pixelbuf_pixelbuf_fill_rainbow(mp_obj_t self, mp_float_t offset, mp_float_t repeat);
+void common_hal_adafruit_pixelbuf_pixelbuf_fade(mp_obj_t self, mp_float_t factor);
+void common_hal_adafruit_pixelbuf_pixelbuf_blend(mp_obj_t self, mp_obj_t a, mp_obj_t b, mp_float_t amount);
+void common_hal_adafruit_pixelbuf_pixelbuf_sparkle(mp_obj_t self, mp_obj_t color, size_t count);
+mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_gamma_table(mp_obj_t self);
+void common_hal_adafruit_pixelbuf_pixelbuf_set_gamma_table(mp_obj_t self, const uint8_t *table);
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(mp_obj_t self, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
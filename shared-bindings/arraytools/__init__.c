@@ -0,0 +1,200 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/binary.h"
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/arraytools/__init__.h"
+
+//| """Fast arithmetic on arrays of numbers
+//|
+//| The functions in this module operate on whole `array.array`, `bytearray` or
+//| `memoryview` objects at once, using the element type of each buffer. They
+//| are much faster than the equivalent Python loops, and are useful for
+//| processing blocks of samples such as those from `analogbufio` or for audio.
+//|
+//| Supported element types are *b*, *B*, *h*, *H*, *i*, *I*, *l*, *L*, *q*, *f*
+//| and *d*, except for unsigned 64-bit types.
+//|
+//| Calculations are done with 64-bit integers, or in floating point if any
+//| array or scalar involved is floating point. Results that do not fit in the
+//| destination's element type are clamped to its minimum or maximum value
+//| rather than wrapping around. Floating point values stored into integer
+//| arrays are truncated towards zero."""
+//|
+//|
+
+static void arraytools_get_array(mp_obj_t obj, mp_uint_t flags, arraytools_array_t *array) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    char typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode;
+    if (!shared_module_arraytools_typecode_is_supported(typecode)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad typecode"));
+    }
+    array->buf = bufinfo.buf;
+    array->len = bufinfo.len / mp_binary_get_size('@', typecode, NULL);
+    array->typecode = typecode;
+}
+
+static mp_obj_t arraytools_binary_op(arraytools_op_t op, mp_obj_t dest_in, mp_obj_t a_in, mp_obj_t b_in) {
+    arraytools_array_t dest, a, b;
+    arraytools_get_array(dest_in, MP_BUFFER_WRITE, &dest);
+    arraytools_get_array(a_in, MP_BUFFER_READ, &a);
+    mp_arg_validate_length(a.len, dest.len, MP_QSTR_a);
+
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(b_in, &bufinfo, MP_BUFFER_READ)) {
+        arraytools_get_array(b_in, MP_BUFFER_READ, &b);
+        mp_arg_validate_length(b.len, dest.len, MP_QSTR_b);
+        shared_module_arraytools_apply(op, &dest, &a, &b, MP_OBJ_NULL, MP_OBJ_NULL);
+    } else {
+        shared_module_arraytools_apply(op, &dest, &a, NULL, b_in, MP_OBJ_NULL);
+    }
+    return dest_in;
+}
+
+//| def add(dest: WriteableBuffer, a: ReadableBuffer, b: ReadableBuffer | float) -> WriteableBuffer:
+//|     """Store ``a[i] + b[i]`` into each ``dest[i]``. ``b`` may be an array or a
+//|     number, which is added to every element. ``dest`` may be the same
+//|     object as ``a`` or ``b``, and all arrays must have the same length.
+//|
+//|     Returns ``dest``."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_add(mp_obj_t dest, mp_obj_t a, mp_obj_t b) {
+    return arraytools_binary_op(ARRAYTOOLS_ADD, dest, a, b);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(arraytools_add_obj, arraytools_add);
+
+//| def sub(dest: WriteableBuffer, a: ReadableBuffer, b: ReadableBuffer | float) -> WriteableBuffer:
+//|     """Store ``a[i] - b[i]`` into each ``dest[i]``, like `add`."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_sub(mp_obj_t dest, mp_obj_t a, mp_obj_t b) {
+    return arraytools_binary_op(ARRAYTOOLS_SUB, dest, a, b);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(arraytools_sub_obj, arraytools_sub);
+
+//| def mul(dest: WriteableBuffer, a: ReadableBuffer, b: ReadableBuffer | float) -> WriteableBuffer:
+//|     """Store ``a[i] * b[i]`` into each ``dest[i]``, like `add`. Multiplying
+//|     an integer array by a floating point number scales it, for instance to
+//|     change the volume of audio samples."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_mul(mp_obj_t dest, mp_obj_t a, mp_obj_t b) {
+    return arraytools_binary_op(ARRAYTOOLS_MUL, dest, a, b);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(arraytools_mul_obj, arraytools_mul);
+
+//| def clamp(dest: WriteableBuffer, a: ReadableBuffer, low: float, high: float) -> WriteableBuffer:
+//|     """Store each ``a[i]`` into ``dest[i]``, limited to be no less than ``low``
+//|     and no greater than ``high``.
+//|
+//|     Returns ``dest``."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_clamp(size_t n_args, const mp_obj_t *args) {
+    arraytools_array_t dest, a;
+    arraytools_get_array(args[0], MP_BUFFER_WRITE, &dest);
+    arraytools_get_array(args[1], MP_BUFFER_READ, &a);
+    mp_arg_validate_length(a.len, dest.len, MP_QSTR_a);
+    shared_module_arraytools_apply(ARRAYTOOLS_CLAMP, &dest, &a, NULL, args[2], args[3]);
+    return args[0];
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(arraytools_clamp_obj, 4, 4, arraytools_clamp);
+
+//| def convert(dest: WriteableBuffer, src: ReadableBuffer) -> WriteableBuffer:
+//|     """Copy each ``src[i]`` into ``dest[i]``, converting between their element
+//|     types. For example, this converts an ``array.array('f')`` into an
+//|     ``array.array('h')``, clamping values that are out of range.
+//|
+//|     Returns ``dest``."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_convert(mp_obj_t dest_in, mp_obj_t src_in) {
+    arraytools_array_t dest, src;
+    arraytools_get_array(dest_in, MP_BUFFER_WRITE, &dest);
+    arraytools_get_array(src_in, MP_BUFFER_READ, &src);
+    mp_arg_validate_length(src.len, dest.len, MP_QSTR_src);
+    shared_module_arraytools_apply(ARRAYTOOLS_CONVERT, &dest, &src, NULL, MP_OBJ_NULL, MP_OBJ_NULL);
+    return dest_in;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arraytools_convert_obj, arraytools_convert);
+
+static mp_obj_t arraytools_reduce(arraytools_reduce_t kind, mp_obj_t a_in) {
+    arraytools_array_t a;
+    arraytools_get_array(a_in, MP_BUFFER_READ, &a);
+    return shared_module_arraytools_reduce(kind, &a);
+}
+
+//| def min(a: ReadableBuffer) -> int | float:
+//|     """Return the smallest element of ``a``, which must not be empty."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_min(mp_obj_t a) {
+    return arraytools_reduce(ARRAYTOOLS_MIN, a);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arraytools_min_obj, arraytools_min);
+
+//| def max(a: ReadableBuffer) -> int | float:
+//|     """Return the largest element of ``a``, which must not be empty."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_max(mp_obj_t a) {
+    return arraytools_reduce(ARRAYTOOLS_MAX, a);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arraytools_max_obj, arraytools_max);
+
+//| def sum(a: ReadableBuffer) -> int | float:
+//|     """Return the sum of the elements of ``a``. The result is an `int` for
+//|     integer arrays and a `float` for floating point arrays."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_sum(mp_obj_t a) {
+    return arraytools_reduce(ARRAYTOOLS_SUM, a);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arraytools_sum_obj, arraytools_sum);
+
+//| def mean(a: ReadableBuffer) -> float:
+//|     """Return the average of the elements of ``a``, which must not be empty."""
+//|     ...
+//|
+//|
+static mp_obj_t arraytools_mean(mp_obj_t a) {
+    return arraytools_reduce(ARRAYTOOLS_MEAN, a);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arraytools_mean_obj, arraytools_mean);
+
+static const mp_rom_map_elem_t arraytools_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_arraytools) },
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&arraytools_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sub), MP_ROM_PTR(&arraytools_sub_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mul), MP_ROM_PTR(&arraytools_mul_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clamp), MP_ROM_PTR(&arraytools_clamp_obj) },
+    { MP_ROM_QSTR(MP_QSTR_convert), MP_ROM_PTR(&arraytools_convert_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&arraytools_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&arraytools_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&arraytools_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&arraytools_mean_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(arraytools_module_globals, arraytools_module_globals_table);
+
+const mp_obj_module_t arraytools_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&arraytools_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_arraytools, arraytools_module);
@@ -0,0 +1,18 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/arraytools/__init__.h"
+
+bool shared_module_arraytools_typecode_is_supported(char typecode);
+
+// Store op(a, b) into dest. b is NULL when x is a scalar second operand.
+// ARRAYTOOLS_CLAMP uses x and y as the bounds; ARRAYTOOLS_CONVERT only uses a.
+void shared_module_arraytools_apply(arraytools_op_t op, const arraytools_array_t *dest,
+    const arraytools_array_t *a, const arraytools_array_t *b, mp_obj_t x, mp_obj_t y);
+
+mp_obj_t shared_module_arraytools_reduce(arraytools_reduce_t kind, const arraytools_array_t *a);
@@ -29,6 +29,7 @@ void common_hal_displayio_auto_primary_display(void);
 
 extern const mp_obj_type_t displayio_colorspace_type;
 extern const cp_enum_obj_t displayio_colorspace_RGB888_obj;
+extern const cp_enum_obj_t displayio_colorspace_RGB565_SWAPPED_obj;
 
 
 // Used in the various bus displays: BusDisplay, EPaperDisplay and ParallelDisplay
@@ -7,8 +7,6 @@
 
 #pragma once
 
-#include "common-hal/microcontroller/Pin.h"
-
 #include "shared-module/framebufferio/FramebufferDisplay.h"
 #include "shared-module/displayio/Group.h"
 
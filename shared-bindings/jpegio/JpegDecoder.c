@@ -10,6 +10,7 @@
 
 #include "shared-bindings/bitmaptools/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/__init__.h"
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-module/jpegio/JpegDecoder.h"
 #include "shared-module/displayio/Bitmap.h"
@@ -87,6 +88,20 @@ static mp_obj_t jpegio_jpegdecoder_open(mp_obj_t self_in, mp_obj_t arg) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 
+static displayio_colorspace_t validate_colorspace(mp_obj_t colorspace_obj) {
+    displayio_colorspace_t colorspace = (displayio_colorspace_t)cp_enum_value(&displayio_colorspace_type, colorspace_obj, MP_QSTR_colorspace);
+    switch (colorspace) {
+        case DISPLAYIO_COLORSPACE_L8:
+        case DISPLAYIO_COLORSPACE_RGB565:
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+        case DISPLAYIO_COLORSPACE_BGR565:
+        case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+            return colorspace;
+        default:
+            mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+    }
+}
+
 //|     def decode(
 //|         self,
 //|         bitmap: displayio.Bitmap,
@@ -100,15 +115,22 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         y2: int,
 //|         skip_source_index: int,
 //|         skip_dest_index: int,
+//|         colorspace: displayio.Colorspace = displayio.Colorspace.RGB565_SWAPPED,
 //|     ) -> None:
 //|         """Decode JPEG data
 //|
 //|         The bitmap must be large enough to contain the decoded image.
-//|         The pixel data is stored in the `displayio.Colorspace.RGB565_SWAPPED` colorspace.
+//|         The pixel data is stored in the given colorspace, which may be ``RGB565_SWAPPED``
+//|         (the default), ``RGB565``, ``BGR565``, ``BGR565_SWAPPED`` or ``L8``. Decoding is
+//|         fastest when the bitmap has 16 bits per value (8 for ``L8``) and no index is skipped.
 //|
 //|         The image is optionally downscaled by a factor of ``2**scale``.
 //|         Scaling by a factor of 8 (scale=3) is particularly efficient in terms of decoding time.
 //|
+//|         Only the parts of the image inside the ``x1``, ``y1``, ``x2``, ``y2`` rectangle that
+//|         land on the bitmap are converted, and decoding stops after its last row, so
+//|         decoding a small region of a large image is much faster than decoding all of it.
+//|
 //|         The remaining parameters are as for `bitmaptools.blit`.
 //|         Because JPEG is a lossy data format, chroma keying based on the "source
 //|         index" is not reliable, because the same original RGB value might end
@@ -134,13 +156,13 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|                                set to None to copy all pixels
 //|         :param int skip_dest_index: bitmap palette index in the destination bitmap that will not get overwritten
 //|                                 by the pixels from the source
+//|         :param displayio.Colorspace colorspace: The format of the pixels stored in the bitmap
 //|         """
 //|
-//|
 static mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_bitmap, ARG_scale, ARG_x, ARG_y, ARGS_X1_Y1_X2_Y2, ARG_skip_source_index, ARG_skip_dest_index };
+    enum { ARG_bitmap, ARG_scale, ARG_x, ARG_y, ARGS_X1_Y1_X2_Y2, ARG_skip_source_index, ARG_skip_dest_index, ARG_colorspace };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_bitmap, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
         { MP_QSTR_scale, MP_ARG_INT, {.u_int = 0 } },
@@ -149,6 +171,7 @@ static mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
         ALLOWED_ARGS_X1_Y1_X2_Y2(0, 0),
         {MP_QSTR_skip_source_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
         {MP_QSTR_skip_dest_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_colorspace, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = (void *)&displayio_colorspace_RGB565_SWAPPED_obj} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -185,15 +208,78 @@ static mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
         skip_dest_index = mp_obj_get_int(args[ARG_skip_dest_index].u_obj);
         skip_dest_index_none = false;
     }
-    common_hal_jpegio_jpegdecoder_decode_into(self, bitmap, scale, x, y, &lim, skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none);
+    displayio_colorspace_t colorspace = validate_colorspace(args[ARG_colorspace].u_obj);
+
+    common_hal_jpegio_jpegdecoder_decode_into(self, bitmap, scale, x, y, &lim, skip_source_index, skip_source_index_none, skip_dest_index, skip_dest_index_none, colorspace);
 
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(jpegio_jpegdecoder_decode_obj, 1, jpegio_jpegdecoder_decode);
 
+//|     def decode_strips(
+//|         self,
+//|         bitmap: displayio.Bitmap,
+//|         callback: Callable[[int, int], None],
+//|         scale: int = 0,
+//|         *,
+//|         colorspace: displayio.Colorspace = displayio.Colorspace.RGB565_SWAPPED,
+//|     ) -> None:
+//|         """Decode JPEG data a strip of rows at a time
+//|
+//|         This shows an image without needing a bitmap as large as the image. ``bitmap``
+//|         holds one strip: it must be at least as tall as a row of JPEG blocks, which is
+//|         ``16 >> scale`` pixels for any image. Columns beyond the bitmap's width are not decoded.
+//|
+//|         Whenever the bitmap is full, and once after the last row, ``callback(y, height)``
+//|         is called. Rows ``0`` to ``height - 1`` of the bitmap then hold rows ``y`` to
+//|         ``y + height - 1`` of the image, for instance to send them to a display.
+//|
+//|         As with `decode`, you must ``open`` a new JPEG afterwards.
+//|
+//|         :param Bitmap bitmap: Buffer for one strip
+//|         :param Callable callback: Called with the image row and number of rows in each strip
+//|         :param int scale: Scale factor from 0 to 3, inclusive.
+//|         :param displayio.Colorspace colorspace: The format of the pixels stored in the bitmap
+//|         """
+//|
+//|
+static mp_obj_t jpegio_jpegdecoder_decode_strips(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    enum { ARG_bitmap, ARG_callback, ARG_scale, ARG_colorspace };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bitmap, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
+        { MP_QSTR_callback, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
+        { MP_QSTR_scale, MP_ARG_INT, {.u_int = 0 } },
+        { MP_QSTR_colorspace, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = (void *)&displayio_colorspace_RGB565_SWAPPED_obj} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t bitmap_in = args[ARG_bitmap].u_obj;
+    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(bitmap_in);
+
+    mp_obj_t callback = args[ARG_callback].u_obj;
+    if (!mp_obj_is_callable(callback)) {
+        mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q, not %q"), MP_QSTR_callback, MP_QSTR_callable, mp_obj_get_type_qstr(callback));
+    }
+
+    int scale = args[ARG_scale].u_int;
+    mp_arg_validate_int_range(scale, 0, 3, MP_QSTR_scale);
+
+    displayio_colorspace_t colorspace = validate_colorspace(args[ARG_colorspace].u_obj);
+
+    common_hal_jpegio_jpegdecoder_decode_strips(self, bitmap, callback, scale, colorspace);
+
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(jpegio_jpegdecoder_decode_strips_obj, 1, jpegio_jpegdecoder_decode_strips);
+
 static const mp_rom_map_elem_t jpegio_jpegdecoder_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&jpegio_jpegdecoder_open_obj) },
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&jpegio_jpegdecoder_decode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode_strips), MP_ROM_PTR(&jpegio_jpegdecoder_decode_strips_obj) },
 };
 static MP_DEFINE_CONST_DICT(jpegio_jpegdecoder_locals_dict, jpegio_jpegdecoder_locals_dict_table);
 
@@ -10,6 +10,7 @@
 #include "py/stream.h"
 #include "shared-module/displayio/Bitmap.h"
 #include "shared-bindings/bitmaptools/__init__.h"
+#include "shared-bindings/displayio/__init__.h"
 
 extern const mp_obj_type_t jpegio_jpegdecoder_type;
 
@@ -24,4 +25,9 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
-    uint32_t skip_dest_index, bool skip_dest_index_none);
+    uint32_t skip_dest_index, bool skip_dest_index_none,
+    displayio_colorspace_t colorspace);
+void common_hal_jpegio_jpegdecoder_decode_strips(
+    jpegio_jpegdecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, mp_obj_t callback, int scale,
+    displayio_colorspace_t colorspace);
@@ -9,6 +9,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/objtuple.h"
@@ -147,6 +148,234 @@ static mp_obj_t struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_m
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
 
+// Get buffer and apply offset, which may be negative to count from the end of buffer.
+static byte *struct_get_buffer(mp_obj_t buffer, mp_int_t offset, mp_uint_t flags, byte **end_p) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, flags);
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset = (mp_int_t)bufinfo.len + offset;
+        if (offset < 0) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+        }
+    }
+    byte *p = (byte *)bufinfo.buf;
+    *end_p = &p[bufinfo.len];
+    return p + offset;
+}
+
+static mp_obj_t struct_new_unpack_iter(struct_struct_obj_t *st, mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    mp_arg_validate_int_min(st->size, 1, MP_QSTR_size);
+    if (bufinfo.len % st->size != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), (int)st->size);
+    }
+    struct_unpack_iter_obj_t *self = mp_obj_malloc(struct_unpack_iter_obj_t, &struct_unpack_iter_type);
+    self->st = st;
+    self->buffer = buffer;
+    self->offset = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//| def iter_unpack(fmt: str, buffer: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|     """Return an iterator that unpacks successive chunks of buffer according to
+//|     the format string fmt. The buffer size must be a multiple of the size
+//|     required by the format. The format is parsed once, not for every chunk."""
+//|     ...
+//|
+//|
+
+static mp_obj_t struct_iter_unpack(mp_obj_t fmt_in, mp_obj_t buffer) {
+    return struct_new_unpack_iter(shared_modules_struct_struct_compile(&struct_struct_type, fmt_in), buffer);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_iter_unpack_obj, struct_iter_unpack);
+
+//| class Struct:
+//|     """A format string parsed once, for packing and unpacking many times.
+//|     Calling its methods is faster than calling the module-level functions
+//|     with the same format, because the format is not parsed again.
+//|
+//|     |see_cpython| :class:`cpython:struct.Struct`."""
+//|
+//|     def __init__(self, format: str) -> None:
+//|         """Parse format, raising an exception if it is not valid."""
+//|         ...
+//|
+static mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    return MP_OBJ_FROM_PTR(shared_modules_struct_struct_compile(type, args[0]));
+}
+
+//|     format: str
+//|     """The format string used to construct this object."""
+//|
+static mp_obj_t struct_struct_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes needed to store the format, as returned by `calcsize`."""
+//|
+static mp_obj_t struct_struct_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->size);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values according to the format. See `struct.pack`."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    vstr_t vstr;
+    vstr_init_len(&vstr, self->size);
+    byte *p = (byte *)vstr.buf;
+    memset(p, 0, self->size);
+    shared_modules_struct_struct_pack_into(self, p, &p[self->size], n_args - 1, &args[1]);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values according to the format into buffer starting at offset.
+//|         See `struct.pack_into`."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *end_p;
+    byte *p = struct_get_buffer(args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE, &end_p);
+    shared_modules_struct_struct_pack_into(self, p, end_p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+//|     def unpack(self, buffer: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpack from buffer according to the format. The buffer size must match
+//|         `size`. See `struct.unpack`."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t buffer) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    byte *end_p;
+    byte *p = struct_get_buffer(buffer, 0, MP_BUFFER_READ, &end_p);
+    return MP_OBJ_FROM_PTR(shared_modules_struct_struct_unpack_from(self, p, end_p, true));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, buffer: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
+//|         """Unpack from buffer starting at offset according to the format.
+//|         See `struct.unpack_from`."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    byte *end_p;
+    byte *p = struct_get_buffer(args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ, &end_p);
+    return MP_OBJ_FROM_PTR(shared_modules_struct_struct_unpack_from(self, p, end_p, false));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_obj, 1, struct_struct_unpack_from);
+
+//|     def unpack_into(self, items: List[Any], buffer: ReadableBuffer, offset: int = 0) -> None:
+//|         """Unpack from buffer starting at offset according to the format, storing
+//|         the values in items instead of a new tuple. items must be a list whose
+//|         length is the number of values in the format. This is not in CPython."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_items, ARG_buffer, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_items, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t items_in = mp_arg_validate_type(args[ARG_items].u_obj, &mp_type_list, MP_QSTR_items);
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(items_in, &len, &items);
+    mp_arg_validate_length(len, self->num_items, MP_QSTR_items);
+
+    byte *end_p;
+    byte *p = struct_get_buffer(args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ, &end_p);
+    shared_modules_struct_struct_unpack_into(self, p, end_p, false, items);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_into_obj, 1, struct_struct_unpack_into);
+
+//|     def iter_unpack(self, buffer: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|         """Return an iterator that unpacks successive chunks of buffer according to
+//|         the format. See `struct.iter_unpack`."""
+//|         ...
+//|
+//|
+static mp_obj_t struct_struct_iter_unpack(mp_obj_t self_in, mp_obj_t buffer) {
+    return struct_new_unpack_iter(MP_OBJ_TO_PTR(self_in), buffer);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_iter_unpack_obj, struct_struct_iter_unpack);
+
+static const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_into), MP_ROM_PTR(&struct_struct_unpack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_struct_iter_unpack_obj) },
+};
+static MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_type,
+    MP_QSTR_Struct,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, struct_struct_make_new,
+    locals_dict, &struct_struct_locals_dict
+    );
+
+static mp_obj_t struct_unpack_iter_iternext(mp_obj_t self_in) {
+    struct_unpack_iter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Fetch the buffer each time, in case it has been resized.
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->buffer, &bufinfo, MP_BUFFER_READ);
+    mp_uint_t size = self->st->size;
+    if (self->offset + size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    byte *p = (byte *)bufinfo.buf + self->offset;
+    self->offset += size;
+    return MP_OBJ_FROM_PTR(shared_modules_struct_struct_unpack_from(self->st, p, p + size, true));
+}
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_unpack_iter_type,
+    MP_QSTR_unpack_iterator,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, struct_unpack_iter_iternext
+    );
+
 static const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_struct) },
     { MP_ROM_QSTR(MP_QSTR_calcsize), MP_ROM_PTR(&struct_calcsize_obj) },
@@ -154,6 +383,8 @@ static const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_unpack_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_iter_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_struct_type) },
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_struct_globals, mp_module_struct_globals_table);
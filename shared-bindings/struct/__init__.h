@@ -9,3 +9,13 @@
 void shared_modules_struct_pack_into(mp_obj_t fmt_in, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args);
 mp_uint_t shared_modules_struct_calcsize(mp_obj_t fmt_in);
 mp_obj_tuple_t *shared_modules_struct_unpack_from(mp_obj_t fmt_in, byte *p, byte *end_p, bool exact_size);
+
+#include "shared-module/struct/__init__.h"
+
+extern const mp_obj_type_t struct_struct_type;
+extern const mp_obj_type_t struct_unpack_iter_type;
+
+struct_struct_obj_t *shared_modules_struct_struct_compile(const mp_obj_type_t *type, mp_obj_t fmt_in);
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *st, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args);
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *st, byte *p, byte *end_p, bool exact_size, mp_obj_t *items);
+mp_obj_tuple_t *shared_modules_struct_struct_unpack_from(struct_struct_obj_t *st, byte *p, byte *end_p, bool exact_size);
@@ -10,6 +10,12 @@
 #include "py/objtype.h"
 #include "py/runtime.h"
 #include "shared-bindings/adafruit_pixelbuf/PixelBuf.h"
+#if CIRCUITPY_RAINBOWIO
+#include "shared-bindings/rainbowio/__init__.h"
+#endif
+#if CIRCUITPY_RANDOM
+#include "shared-bindings/random/__init__.h"
+#endif
 #include <string.h>
 #include <math.h>
 
@@ -28,6 +34,9 @@ void common_hal_adafruit_pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *se
     self->byteorder = *byteorder;  // Copied because we modify for dotstar
     self->bytes_per_pixel = byteorder->is_dotstar ? 4 : byteorder->bpp;
     self->auto_write = false;
+    self->pre_brightness_buffer = NULL;
+    self->gamma_table = mp_const_none;
+    self->output_lut = NULL;
 
     size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
     self->transmit_buffer_obj = mp_obj_new_bytearray_of_zeros(header_len + pixel_len + trailer_len);
@@ -84,6 +93,28 @@ mp_float_t common_hal_adafruit_pixelbuf_pixelbuf_get_brightness(mp_obj_t self_in
     return self->brightness;
 }
 
+// Recompute post_brightness_buffer[start:end] from pre_brightness_buffer.
+static void pixelbuf_scale_bytes(pixelbuf_pixelbuf_obj_t *self, size_t start, size_t end) {
+    const uint8_t *src = self->pre_brightness_buffer;
+    uint8_t *dest = self->post_brightness_buffer;
+    uint16_t scaled_brightness = self->scaled_brightness;
+    for (size_t i = start; i < end; i++) {
+        // Don't adjust per-pixel luminance bytes in dotstar mode
+        if (self->byteorder.is_dotstar && i % 4 == 0) {
+            dest[i] = src[i];
+            continue;
+        }
+        dest[i] = (src[i] * scaled_brightness) / 256;
+    }
+}
+
+static void pixelbuf_update_output_lut(pixelbuf_pixelbuf_obj_t *self) {
+    const uint8_t *gamma = ((mp_obj_str_t *)MP_OBJ_TO_PTR(self->gamma_table))->data;
+    for (size_t i = 0; i < 256; i++) {
+        self->output_lut[i] = (gamma[i] * self->scaled_brightness) / 256;
+    }
+}
+
 void common_hal_adafruit_pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_float_t brightness) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
     // Skip out if the brightness is already set. The default of self->brightness is 1.0. So, this
@@ -96,20 +127,20 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_f
     }
     self->scaled_brightness = new_scaled_brightness;
     size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
-    if (self->scaled_brightness == 0x100 && !self->pre_brightness_buffer) {
+    if (self->output_lut) {
+        // show() applies the combined table, so there is nothing to rescale here.
+        pixelbuf_update_output_lut(self);
+        if (self->auto_write) {
+            common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+        }
+    } else if (self->scaled_brightness == 0x100 && !self->pre_brightness_buffer) {
         return;
     } else {
         if (self->pre_brightness_buffer == NULL) {
             self->pre_brightness_buffer = m_malloc(pixel_len);
             memcpy(self->pre_brightness_buffer, self->post_brightness_buffer, pixel_len);
         }
-        for (size_t i = 0; i < pixel_len; i++) {
-            // Don't adjust per-pixel luminance bytes in dotstar mode
-            if (self->byteorder.is_dotstar && i % 4 == 0) {
-                continue;
-            }
-            self->post_brightness_buffer[i] = (self->pre_brightness_buffer[i] * self->scaled_brightness) / 256;
-        }
+        pixelbuf_scale_bytes(self, 0, pixel_len);
 
         if (self->auto_write) {
             common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
@@ -157,7 +188,7 @@ static void pixelbuf_parse_color(pixelbuf_pixelbuf_obj_t *self, mp_obj_t color,
         *b = _pixelbuf_get_as_uint8(items[PIXEL_B]);
         if (len > 3) {
             if (mp_obj_is_float(items[PIXEL_W])) {
-                *w = 255 * mp_obj_get_float(items[PIXEL_W]);
+                *w = (uint8_t)(255 * mp_obj_get_float(items[PIXEL_W]));
             } else {
                 *w = mp_obj_get_int_truncated(items[PIXEL_W]);
             }
@@ -188,7 +219,10 @@ static void pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t *self, size_t index
     pixelbuf_rgbw_t *rgbw_order = &self->byteorder.byteorder;
     size_t offset = index * self->bytes_per_pixel;
     uint8_t *scaled_buffer, *unscaled_buffer;
-    if (self->pre_brightness_buffer) {
+    if (self->output_lut) {
+        scaled_buffer = NULL;
+        unscaled_buffer = self->pre_brightness_buffer + offset;
+    } else if (self->pre_brightness_buffer) {
         scaled_buffer = self->post_brightness_buffer + offset;
         unscaled_buffer = self->pre_brightness_buffer + offset;
     } else {
@@ -260,6 +294,255 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t s
 
 
 
+// Colors are rendered into pre_brightness_buffer when there is one. finish_render() then updates
+// post_brightness_buffer to match.
+static uint8_t *pixelbuf_render_buffer(pixelbuf_pixelbuf_obj_t *self) {
+    return self->pre_brightness_buffer ? self->pre_brightness_buffer : self->post_brightness_buffer;
+}
+
+static void pixelbuf_finish_render(mp_obj_t self_in, pixelbuf_pixelbuf_obj_t *self, size_t byte_count) {
+    if (self->pre_brightness_buffer && !self->output_lut) {
+        pixelbuf_scale_bytes(self, 0, byte_count);
+    }
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
+
+// Palettes with up to this many entries are converted once, on the stack, by fill_palette.
+#define PIXELBUF_PALETTE_CACHE_ENTRIES (16)
+
+// Convert packed pixels in the given format to this buffer's byteorder.
+static void pixelbuf_convert_pixels(pixelbuf_pixelbuf_obj_t *self, const pixelbuf_byteorder_details_t *format,
+    const uint8_t *buf, uint8_t *dest, size_t pixel_count) {
+    const pixelbuf_rgbw_t *src_order = &format->byteorder;
+    const pixelbuf_rgbw_t *dest_order = &self->byteorder.byteorder;
+    size_t src_bpp = format->bpp;
+    size_t dest_bpp = self->bytes_per_pixel;
+    bool dotstar = self->byteorder.is_dotstar;
+
+    // Dotstar pixels always go through the loop below so that the start bits get set.
+    bool same_layout = src_bpp == dest_bpp && !format->is_dotstar && !dotstar &&
+        src_order->r == dest_order->r && src_order->g == dest_order->g && src_order->b == dest_order->b &&
+        (dest_bpp == 3 || (format->has_white == self->byteorder.has_white && src_order->w == dest_order->w));
+    if (same_layout) {
+        memcpy(dest, buf, pixel_count * dest_bpp);
+        return;
+    }
+    // A source without white gives white 0, or full per-pixel brightness for dotstars.
+    uint8_t default_w = dotstar ? DOTSTAR_LED_START_FULL_BRIGHT : 0;
+    for (size_t i = 0; i < pixel_count; i++, buf += src_bpp, dest += dest_bpp) {
+        uint8_t r, g, b, w = default_w;
+        if (src_bpp == 2) {
+            // Little endian RGB565, such as a 16 bit displayio.Bitmap.
+            uint16_t rgb565 = buf[0] | (buf[1] << 8);
+            r = (rgb565 >> 8) & 0xf8;
+            g = (rgb565 >> 3) & 0xfc;
+            b = (rgb565 << 3) & 0xf8;
+            r |= r >> 5;
+            g |= g >> 6;
+            b |= b >> 5;
+        } else {
+            r = buf[src_order->r];
+            g = buf[src_order->g];
+            b = buf[src_order->b];
+            if (format->is_dotstar) {
+                w = buf[0];
+                if (dotstar) {
+                    w |= DOTSTAR_LED_START;
+                } else {
+                    // Use the 5 bit per-pixel brightness as the white value.
+                    w = (w & 0x1f) * 255 / 31;
+                }
+            } else if (format->has_white) {
+                w = buf[src_order->w];
+                if (dotstar) {
+                    w = DOTSTAR_LED_START | w >> 3;
+                }
+            }
+        }
+        dest[dest_order->r] = r;
+        dest[dest_order->g] = g;
+        dest[dest_order->b] = b;
+        if (dest_bpp == 4) {
+            dest[dest_order->w] = w;
+        }
+    }
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_set_from_buffer(mp_obj_t self_in, const uint8_t *buf, size_t row_length,
+    size_t rows, size_t stride, const pixelbuf_byteorder_details_t *format) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    uint8_t *dest = pixelbuf_render_buffer(self);
+    size_t row_bytes = row_length * self->bytes_per_pixel;
+    // Source rows are `stride` bytes apart but land back to back in the pixel buffer.
+    for (size_t y = 0; y < rows; y++) {
+        pixelbuf_convert_pixels(self, format, buf + y * stride, dest + y * row_bytes, row_length);
+    }
+    pixelbuf_finish_render(self_in, self, rows * row_bytes);
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_fill_gradient(mp_obj_t self_in, mp_obj_t start_color, mp_obj_t end_color,
+    size_t start, size_t stop) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    color_u c0, c1;
+    pixelbuf_parse_color(self, start_color, &c0.r, &c0.g, &c0.b, &c0.w);
+    pixelbuf_parse_color(self, end_color, &c1.r, &c1.g, &c1.b, &c1.w);
+    size_t steps = stop - start > 1 ? stop - start - 1 : 1;
+    for (size_t i = start; i < stop; i++) {
+        // Position along the gradient in 1/256ths.
+        int32_t t = (i - start) * 256 / steps;
+        pixelbuf_set_pixel_color(self, i,
+            c0.r + ((c1.r - c0.r) * t) / 256,
+            c0.g + ((c1.g - c0.g) * t) / 256,
+            c0.b + ((c1.b - c0.b) * t) / 256,
+            c0.w + ((c1.w - c0.w) * t) / 256);
+    }
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_fill_palette(mp_obj_t self_in, const uint8_t *palette, size_t entries,
+    const pixelbuf_byteorder_details_t *format, size_t offset) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    size_t bpp = self->bytes_per_pixel;
+    uint8_t *dest = pixelbuf_render_buffer(self);
+    size_t entry = offset % entries;
+    // Small palettes are converted once on the stack and then copied as whole pixels;
+    // larger ones are converted an entry at a time so that nothing is allocated.
+    uint8_t converted[PIXELBUF_PALETTE_CACHE_ENTRIES * 4];
+    bool cached = entries <= PIXELBUF_PALETTE_CACHE_ENTRIES;
+    if (cached) {
+        pixelbuf_convert_pixels(self, format, palette, converted, entries);
+    }
+    for (size_t i = 0; i < self->pixel_count; i++, dest += bpp) {
+        if (cached) {
+            memcpy(dest, converted + entry * bpp, bpp);
+        } else {
+            pixelbuf_convert_pixels(self, format, palette + entry * format->bpp, dest, 1);
+        }
+        if (++entry == entries) {
+            entry = 0;
+        }
+    }
+    pixelbuf_finish_render(self_in, self, self->pixel_count * bpp);
+}
+
+#if CIRCUITPY_RAINBOWIO
+void common_hal_adafruit_pixelbuf_pixelbuf_fill_rainbow(mp_obj_t self_in, mp_float_t offset, mp_float_t repeat) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    uint8_t w = self->byteorder.is_dotstar ? 255 : 0;
+    mp_float_t step = self->pixel_count ? 256 * repeat / self->pixel_count : 0;
+    for (size_t i = 0; i < self->pixel_count; i++) {
+        int32_t color = colorwheel(offset + i * step);
+        pixelbuf_set_pixel_color(self, i, color >> 16 & 0xff, color >> 8 & 0xff, color & 0xff, w);
+    }
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
+#endif
+
+void common_hal_adafruit_pixelbuf_pixelbuf_fade(mp_obj_t self_in, mp_float_t factor) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    uint16_t scale = (uint16_t)(factor * 256);
+    uint8_t *buf = pixelbuf_render_buffer(self);
+    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    for (size_t i = 0; i < pixel_len; i++) {
+        // Leave dotstar per-pixel brightness alone.
+        if (self->byteorder.is_dotstar && i % 4 == 0) {
+            continue;
+        }
+        buf[i] = (buf[i] * scale) / 256;
+    }
+    pixelbuf_finish_render(self_in, self, pixel_len);
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_blend(mp_obj_t self_in, mp_obj_t a_in, mp_obj_t b_in, mp_float_t amount) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    pixelbuf_pixelbuf_obj_t *a = native_pixelbuf(a_in);
+    pixelbuf_pixelbuf_obj_t *b = native_pixelbuf(b_in);
+    // Both sources are read before the pixel is written so either may be self.
+    const uint8_t *src_a = pixelbuf_render_buffer(a);
+    const uint8_t *src_b = pixelbuf_render_buffer(b);
+    uint8_t *dest = pixelbuf_render_buffer(self);
+    int32_t t = (int32_t)(amount * 256);
+    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    for (size_t i = 0; i < pixel_len; i++) {
+        int32_t va = src_a[i];
+        int32_t vb = src_b[i];
+        if (self->byteorder.is_dotstar && i % 4 == 0) {
+            va &= 0x1f;
+            vb &= 0x1f;
+            dest[i] = DOTSTAR_LED_START | (va + ((vb - va) * t) / 256);
+        } else {
+            dest[i] = va + ((vb - va) * t) / 256;
+        }
+    }
+    pixelbuf_finish_render(self_in, self, pixel_len);
+}
+
+#if CIRCUITPY_RANDOM || MICROPY_PY_RANDOM
+static size_t pixelbuf_random_index(size_t n) {
+    #if CIRCUITPY_RANDOM
+    return shared_modules_random_randrange(0, n, 1);
+    #else
+    // Without CircuitPython's random (such as on unix) use the port's random module. getrandbits
+    // is always there and 30 bits stay a small int; the modulo bias is negligible for a strip.
+    mp_obj_t random = mp_import_name(MP_QSTR_random, mp_const_none, MP_OBJ_NEW_SMALL_INT(0));
+    mp_obj_t bits = mp_call_function_1(mp_load_attr(random, MP_QSTR_getrandbits), MP_OBJ_NEW_SMALL_INT(30));
+    return (size_t)mp_obj_get_int(bits) % n;
+    #endif
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_sparkle(mp_obj_t self_in, mp_obj_t color, size_t count) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    uint8_t r, g, b, w;
+    pixelbuf_parse_color(self, color, &r, &g, &b, &w);
+    for (size_t i = 0; i < count && self->pixel_count; i++) {
+        size_t index = pixelbuf_random_index(self->pixel_count);
+        pixelbuf_set_pixel_color(self, index, r, g, b, w);
+    }
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
+#endif
+
+mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_gamma_table(mp_obj_t self_in) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    return self->gamma_table;
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_set_gamma_table(mp_obj_t self_in, const uint8_t *table) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    if (table == NULL) {
+        if (self->output_lut == NULL) {
+            return;
+        }
+        m_del(uint8_t, self->output_lut, 256);
+        self->output_lut = NULL;
+        self->gamma_table = mp_const_none;
+        // Go back to scaling as colors are set.
+        pixelbuf_scale_bytes(self, 0, pixel_len);
+    } else {
+        if (self->pre_brightness_buffer == NULL) {
+            self->pre_brightness_buffer = m_malloc(pixel_len);
+            memcpy(self->pre_brightness_buffer, self->post_brightness_buffer, pixel_len);
+        }
+        if (self->output_lut == NULL) {
+            self->output_lut = m_new(uint8_t, 256);
+        }
+        self->gamma_table = mp_obj_new_bytes(table, 256);
+        pixelbuf_update_output_lut(self);
+    }
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
+
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel(mp_obj_t self_in, size_t index, mp_obj_t value) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
     _pixelbuf_set_pixel(self, index, value);
@@ -295,6 +578,24 @@ mp_obj_t common_hal_adafruit_pixelbuf_pixelbuf_get_pixel(mp_obj_t self_in, size_
 
 void common_hal_adafruit_pixelbuf_pixelbuf_show(mp_obj_t self_in) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    if (self->output_lut) {
+        const uint8_t *lut = self->output_lut;
+        const uint8_t *src = self->pre_brightness_buffer;
+        uint8_t *out = self->post_brightness_buffer;
+        size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+        if (self->byteorder.is_dotstar) {
+            for (size_t i = 0; i < pixel_len; i += 4) {
+                out[i] = src[i];
+                out[i + 1] = lut[src[i + 1]];
+                out[i + 2] = lut[src[i + 2]];
+                out[i + 3] = lut[src[i + 3]];
+            }
+        } else {
+            for (size_t i = 0; i < pixel_len; i++) {
+                out[i] = lut[src[i]];
+            }
+        }
+    }
     mp_obj_t dest[2 + 1];
     mp_load_method(self_in, MP_QSTR__transmit, dest);
 
@@ -36,6 +36,11 @@ typedef struct {
     // account for any header.
     uint8_t *post_brightness_buffer;
     uint8_t *pre_brightness_buffer;
+    // Optional 256 entry gamma table (a bytes object) and the same table with brightness folded
+    // in. When set, colors are only stored in pre_brightness_buffer and the table is applied by
+    // show().
+    mp_obj_t gamma_table;
+    uint8_t *output_lut;
     bool auto_write;
 } pixelbuf_pixelbuf_obj_t;
 
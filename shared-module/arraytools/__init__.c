@@ -0,0 +1,354 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <limits.h>
+#include <math.h>
+
+#include "py/runtime.h"
+#include "py/smallint.h"
+
+#include "shared-bindings/arraytools/__init__.h"
+
+// Elements are processed in chunks: each operand is widened from its own
+// element type into a scratch array, the chunk is combined there, and the
+// result is narrowed into dest with saturation. This keeps the loops tight
+// while needing one loader and one storer per element type rather than one
+// kernel per combination of types.
+#define ARRAYTOOLS_CHUNK (32)
+
+// X(typecode, C type, minimum, maximum) for each supported integer type.
+#define ARRAYTOOLS_INT_TYPES(X) \
+    X('b', signed char, SCHAR_MIN, SCHAR_MAX) \
+    X('B', unsigned char, 0, UCHAR_MAX) \
+    X('h', short, SHRT_MIN, SHRT_MAX) \
+    X('H', unsigned short, 0, USHRT_MAX) \
+    X('i', int, INT_MIN, INT_MAX) \
+    X('I', unsigned int, 0, UINT_MAX) \
+    X('l', long, LONG_MIN, LONG_MAX) \
+    X('L', unsigned long, 0, ULONG_MAX) \
+    X('q', long long, LLONG_MIN, LLONG_MAX)
+
+#define ARRAYTOOLS_FLOAT_TYPES(X) \
+    X('f', float) \
+    X('d', double)
+
+bool shared_module_arraytools_typecode_is_supported(char typecode) {
+    switch (typecode) {
+        case 'b':
+        case 'B':
+        case 'h':
+        case 'H':
+        case 'i':
+        case 'l':
+        case 'q':
+        case 'f':
+        case 'd':
+            return true;
+        // 64-bit unsigned values don't fit in the int64_t scratch values.
+        case 'I':
+            return sizeof(unsigned int) < sizeof(int64_t);
+        case 'L':
+            return sizeof(unsigned long) < sizeof(int64_t);
+        default:
+            return false;
+    }
+}
+
+static bool is_float_typecode(char typecode) {
+    return typecode == 'f' || typecode == 'd';
+}
+
+static void load_int(int64_t *out, const arraytools_array_t *a, size_t start, size_t n) {
+    switch (a->typecode) {
+        #define LOAD_INT(TC, T, LO, HI) \
+    case TC: { \
+        const T *p = (const T *)a->buf + start; \
+        for (size_t i = 0; i < n; i++) { \
+            out[i] = (int64_t)p[i]; \
+        } \
+        break; \
+    }
+        ARRAYTOOLS_INT_TYPES(LOAD_INT)
+        #undef LOAD_INT
+    }
+}
+
+static void load_float(mp_float_t *out, const arraytools_array_t *a, size_t start, size_t n) {
+    switch (a->typecode) {
+        #define LOAD_FLOAT(TC, T, ...) \
+    case TC: { \
+        const T *p = (const T *)a->buf + start; \
+        for (size_t i = 0; i < n; i++) { \
+            out[i] = (mp_float_t)p[i]; \
+        } \
+        break; \
+    }
+        ARRAYTOOLS_INT_TYPES(LOAD_FLOAT)
+        ARRAYTOOLS_FLOAT_TYPES(LOAD_FLOAT)
+        #undef LOAD_FLOAT
+    }
+}
+
+static void store_int(const arraytools_array_t *dest, size_t start, const int64_t *in, size_t n) {
+    switch (dest->typecode) {
+        #define STORE_INT(TC, T, LO, HI) \
+    case TC: { \
+        T *p = (T *)dest->buf + start; \
+        for (size_t i = 0; i < n; i++) { \
+            int64_t v = in[i]; \
+            p[i] = v < (int64_t)(LO) ? (T)(LO) : v > (int64_t)(HI) ? (T)(HI) : (T)v; \
+        } \
+        break; \
+    }
+        ARRAYTOOLS_INT_TYPES(STORE_INT)
+        #undef STORE_INT
+    }
+}
+
+static void store_float(const arraytools_array_t *dest, size_t start, const mp_float_t *in, size_t n) {
+    switch (dest->typecode) {
+        // Integers are truncated towards zero like int(), then saturated; NaN becomes 0.
+        #define STORE_FLOAT_AS_INT(TC, T, LO, HI) \
+    case TC: { \
+        T *p = (T *)dest->buf + start; \
+        for (size_t i = 0; i < n; i++) { \
+            mp_float_t v = in[i]; \
+            p[i] = v >= (mp_float_t)(HI) ? (T)(HI) : v > (mp_float_t)(LO) ? (T)v : v <= (mp_float_t)(LO) ? (T)(LO) : 0; \
+        } \
+        break; \
+    }
+        ARRAYTOOLS_INT_TYPES(STORE_FLOAT_AS_INT)
+        #undef STORE_FLOAT_AS_INT
+        #define STORE_FLOAT(TC, T) \
+    case TC: { \
+        T *p = (T *)dest->buf + start; \
+        for (size_t i = 0; i < n; i++) { \
+            p[i] = (T)in[i]; \
+        } \
+        break; \
+    }
+        ARRAYTOOLS_FLOAT_TYPES(STORE_FLOAT)
+        #undef STORE_FLOAT
+    }
+}
+
+// Only products of 32-bit unsigned or 64-bit values can overflow the scratch
+// values; saturate those too rather than wrapping.
+static int64_t saturating_add(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_add_overflow(a, b, &r)) {
+        r = b < 0 ? INT64_MIN : INT64_MAX;
+    }
+    return r;
+}
+
+static int64_t saturating_sub(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_sub_overflow(a, b, &r)) {
+        r = b < 0 ? INT64_MAX : INT64_MIN;
+    }
+    return r;
+}
+
+static int64_t saturating_mul(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_mul_overflow(a, b, &r)) {
+        r = (a < 0) != (b < 0) ? INT64_MIN : INT64_MAX;
+    }
+    return r;
+}
+
+static void apply_int(arraytools_op_t op, const arraytools_array_t *dest,
+    const arraytools_array_t *a, const arraytools_array_t *b, mp_obj_t x, mp_obj_t y) {
+    int64_t va[ARRAYTOOLS_CHUNK], vb[ARRAYTOOLS_CHUNK];
+    int64_t lo = 0, hi = 0;
+    if (op == ARRAYTOOLS_CLAMP) {
+        lo = mp_obj_get_int(x);
+        hi = mp_obj_get_int(y);
+    } else if (op != ARRAYTOOLS_CONVERT && b == NULL) {
+        // A scalar operand is the same for every chunk.
+        int64_t v = mp_obj_get_int(x);
+        for (size_t i = 0; i < ARRAYTOOLS_CHUNK; i++) {
+            vb[i] = v;
+        }
+    }
+
+    for (size_t start = 0; start < dest->len; start += ARRAYTOOLS_CHUNK) {
+        size_t n = MIN(ARRAYTOOLS_CHUNK, dest->len - start);
+        load_int(va, a, start, n);
+        if (b != NULL) {
+            load_int(vb, b, start, n);
+        }
+        switch (op) {
+            case ARRAYTOOLS_ADD:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] = saturating_add(va[i], vb[i]);
+                }
+                break;
+            case ARRAYTOOLS_SUB:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] = saturating_sub(va[i], vb[i]);
+                }
+                break;
+            case ARRAYTOOLS_MUL:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] = saturating_mul(va[i], vb[i]);
+                }
+                break;
+            case ARRAYTOOLS_CLAMP:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] = va[i] < lo ? lo : va[i] > hi ? hi : va[i];
+                }
+                break;
+            case ARRAYTOOLS_CONVERT:
+                break;
+        }
+        store_int(dest, start, va, n);
+    }
+}
+
+static void apply_float(arraytools_op_t op, const arraytools_array_t *dest,
+    const arraytools_array_t *a, const arraytools_array_t *b, mp_obj_t x, mp_obj_t y) {
+    mp_float_t va[ARRAYTOOLS_CHUNK], vb[ARRAYTOOLS_CHUNK];
+    mp_float_t lo = 0, hi = 0;
+    if (op == ARRAYTOOLS_CLAMP) {
+        lo = mp_obj_get_float(x);
+        hi = mp_obj_get_float(y);
+    } else if (op != ARRAYTOOLS_CONVERT && b == NULL) {
+        mp_float_t v = mp_obj_get_float(x);
+        for (size_t i = 0; i < ARRAYTOOLS_CHUNK; i++) {
+            vb[i] = v;
+        }
+    }
+
+    for (size_t start = 0; start < dest->len; start += ARRAYTOOLS_CHUNK) {
+        size_t n = MIN(ARRAYTOOLS_CHUNK, dest->len - start);
+        load_float(va, a, start, n);
+        if (b != NULL) {
+            load_float(vb, b, start, n);
+        }
+        switch (op) {
+            case ARRAYTOOLS_ADD:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] += vb[i];
+                }
+                break;
+            case ARRAYTOOLS_SUB:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] -= vb[i];
+                }
+                break;
+            case ARRAYTOOLS_MUL:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] *= vb[i];
+                }
+                break;
+            case ARRAYTOOLS_CLAMP:
+                for (size_t i = 0; i < n; i++) {
+                    va[i] = va[i] < lo ? lo : va[i] > hi ? hi : va[i];
+                }
+                break;
+            case ARRAYTOOLS_CONVERT:
+                break;
+        }
+        store_float(dest, start, va, n);
+    }
+}
+
+void shared_module_arraytools_apply(arraytools_op_t op, const arraytools_array_t *dest,
+    const arraytools_array_t *a, const arraytools_array_t *b, mp_obj_t x, mp_obj_t y) {
+    // Work in floating point if any operand is floating point.
+    bool use_float = is_float_typecode(dest->typecode) || is_float_typecode(a->typecode);
+    if (b != NULL) {
+        use_float |= is_float_typecode(b->typecode);
+    } else if (op != ARRAYTOOLS_CONVERT) {
+        use_float |= mp_obj_is_float(x);
+    }
+    if (op == ARRAYTOOLS_CLAMP) {
+        use_float |= mp_obj_is_float(y);
+    }
+
+    if (use_float) {
+        apply_float(op, dest, a, b, x, y);
+    } else {
+        apply_int(op, dest, a, b, x, y);
+    }
+}
+
+static mp_obj_t new_int_from_int64(int64_t v) {
+    if (v >= MP_SMALL_INT_MIN && v <= MP_SMALL_INT_MAX) {
+        return MP_OBJ_NEW_SMALL_INT((mp_int_t)v);
+    }
+    return mp_obj_new_int_from_ll(v);
+}
+
+mp_obj_t shared_module_arraytools_reduce(arraytools_reduce_t kind, const arraytools_array_t *a) {
+    if (a->len == 0 && kind != ARRAYTOOLS_SUM) {
+        mp_raise_ValueError(MP_ERROR_TEXT("arg is an empty sequence"));
+    }
+
+    if (is_float_typecode(a->typecode)) {
+        mp_float_t v[ARRAYTOOLS_CHUNK];
+        mp_float_t acc = kind == ARRAYTOOLS_MIN ? (mp_float_t)INFINITY : kind == ARRAYTOOLS_MAX ? -(mp_float_t)INFINITY : 0;
+        for (size_t start = 0; start < a->len; start += ARRAYTOOLS_CHUNK) {
+            size_t n = MIN(ARRAYTOOLS_CHUNK, a->len - start);
+            load_float(v, a, start, n);
+            switch (kind) {
+                case ARRAYTOOLS_MIN:
+                    for (size_t i = 0; i < n; i++) {
+                        acc = v[i] < acc ? v[i] : acc;
+                    }
+                    break;
+                case ARRAYTOOLS_MAX:
+                    for (size_t i = 0; i < n; i++) {
+                        acc = v[i] > acc ? v[i] : acc;
+                    }
+                    break;
+                case ARRAYTOOLS_SUM:
+                case ARRAYTOOLS_MEAN:
+                    for (size_t i = 0; i < n; i++) {
+                        acc += v[i];
+                    }
+                    break;
+            }
+        }
+        if (kind == ARRAYTOOLS_MEAN) {
+            acc /= a->len;
+        }
+        return mp_obj_new_float(acc);
+    }
+
+    int64_t v[ARRAYTOOLS_CHUNK];
+    int64_t acc = kind == ARRAYTOOLS_MIN ? INT64_MAX : kind == ARRAYTOOLS_MAX ? INT64_MIN : 0;
+    for (size_t start = 0; start < a->len; start += ARRAYTOOLS_CHUNK) {
+        size_t n = MIN(ARRAYTOOLS_CHUNK, a->len - start);
+        load_int(v, a, start, n);
+        switch (kind) {
+            case ARRAYTOOLS_MIN:
+                for (size_t i = 0; i < n; i++) {
+                    acc = v[i] < acc ? v[i] : acc;
+                }
+                break;
+            case ARRAYTOOLS_MAX:
+                for (size_t i = 0; i < n; i++) {
+                    acc = v[i] > acc ? v[i] : acc;
+                }
+                break;
+            case ARRAYTOOLS_SUM:
+            case ARRAYTOOLS_MEAN:
+                for (size_t i = 0; i < n; i++) {
+                    if (__builtin_add_overflow(acc, v[i], &acc)) {
+                        mp_raise_msg(&mp_type_OverflowError, MP_ERROR_TEXT("overflow converting long int to machine word"));
+                    }
+                }
+                break;
+        }
+    }
+    if (kind == ARRAYTOOLS_MEAN) {
+        return mp_obj_new_float((mp_float_t)acc / a->len);
+    }
+    return new_int_from_int64(acc);
+}
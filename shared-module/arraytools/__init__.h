@@ -0,0 +1,31 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// A typed view of a buffer: len is in elements, not bytes.
+typedef struct {
+    void *buf;
+    size_t len;
+    char typecode;
+} arraytools_array_t;
+
+typedef enum {
+    ARRAYTOOLS_ADD,
+    ARRAYTOOLS_SUB,
+    ARRAYTOOLS_MUL,
+    ARRAYTOOLS_CLAMP,
+    ARRAYTOOLS_CONVERT,
+} arraytools_op_t;
+
+typedef enum {
+    ARRAYTOOLS_MIN,
+    ARRAYTOOLS_MAX,
+    ARRAYTOOLS_SUM,
+    ARRAYTOOLS_MEAN,
+} arraytools_reduce_t;
@@ -68,15 +68,17 @@ static void *scratchpad_alloc(size_t sz) {
     return scratchpad;
 }
 
-static void scratch_bitmap16(displayio_bitmap_t *buf, int rows, int cols) {
+// Allocates a 16-bit scratch bitmap, followed by `extra` bytes that are returned.
+static void *scratch_bitmap16(displayio_bitmap_t *buf, int rows, int cols, size_t extra) {
     int stride = (cols + 1) / 2;
     size_t sz = rows * stride * sizeof(uint32_t);
-    void *data = scratchpad_alloc(sz);
+    void *data = scratchpad_alloc(sz + extra);
     // memset(data, 0, sz);
     buf->width = cols;
     buf->height = rows;
     buf->stride = stride;
     buf->data = data;
+    return (uint8_t *)data + sz;
 }
 
 // https://en.wikipedia.org/wiki/YCbCr -> JPEG Conversion
@@ -88,6 +90,253 @@ uint16_t imlib_yuv_to_rgb(uint8_t y, int8_t u, int8_t v) {
     return COLOR_R8_G8_B8_TO_RGB565(r, g, b);
 }
 
+// Reads row y of the mask as one byte per pixel, nonzero where the bitmap pixel is left alone.
+static void morph_mask_row(displayio_bitmap_t *mask, int y, int width, uint8_t *out) {
+    memset(out, 0, width);
+    if (y >= mask->height) {
+        return;
+    }
+    width = IM_MIN(width, mask->width);
+    uint32_t *row = mask->data + y * mask->stride;
+    switch (mask->bits_per_value) {
+        case 8:
+            for (int x = 0; x < width; x++) {
+                out[x] = ((uint8_t *)row)[x] != 0;
+            }
+            break;
+        case 16:
+            for (int x = 0; x < width; x++) {
+                out[x] = ((uint16_t *)row)[x] != 0;
+            }
+            break;
+        case 32:
+            for (int x = 0; x < width; x++) {
+                out[x] = row[x] != 0;
+            }
+            break;
+        default: {
+            int values_per_byte = 8 / mask->bits_per_value;
+            for (int x = 0; x < width; x++) {
+                uint8_t bits = ((uint8_t *)row)[x >> mask->x_shift];
+                int bit_position = (values_per_byte - (x & mask->x_mask) - 1) * mask->bits_per_value;
+                out[x] = (bits >> bit_position) & mask->bitmask;
+            }
+            break;
+        }
+    }
+}
+
+static int morph_gcd(int a, int b) {
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Finds integer vectors with krn[j * n + k] == col[j] * row[k], so that the kernel can be
+// applied as a vertical pass followed by a horizontal pass with exactly the same result.
+// Box and Gaussian kernels are separable.
+static bool morph_kernel_separable(int n, const int *krn, int *col, int *row) {
+    // The row shape is the first nonzero row of the kernel, divided by the gcd of its entries.
+    int j0 = -1, k0 = -1;
+    for (int i = 0; i < n * n && k0 < 0; i++) {
+        if (krn[i]) {
+            j0 = i / n;
+            k0 = i % n;
+        }
+    }
+    if (k0 < 0) {
+        return false;
+    }
+    int g = 0;
+    for (int k = 0; k < n; k++) {
+        int v = krn[j0 * n + k];
+        g = morph_gcd(g, v < 0 ? -v : v);
+    }
+    for (int k = 0; k < n; k++) {
+        row[k] = krn[j0 * n + k] / g;
+    }
+    for (int j = 0; j < n; j++) {
+        if (krn[j * n + k0] % row[k0]) {
+            return false;
+        }
+        col[j] = krn[j * n + k0] / row[k0];
+        for (int k = 0; k < n; k++) {
+            if (col[j] * row[k] != krn[j * n + k]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+typedef struct {
+    displayio_bitmap_t *bitmap;
+    int ksize;
+    const int *krn;
+    int32_t m_int, b_int;
+    bool threshold, invert;
+    int offset;
+    const uint8_t *mask_row; // NULL if there is no mask
+    // For separable kernels, the vertical pass for the current row, per channel.
+    int32_t *r_col, *g_col, *b_col;
+    const int *col_k, *row_k;
+    bool box; // All kernel weights are equal, so window sums are kept as running sums.
+    int box_weight;
+} morph_args_t;
+
+// Scales and clamps one filtered pixel, then applies the threshold.
+static inline int morph_finish_pixel(const morph_args_t *args, int32_t r_acc, int32_t g_acc, int32_t b_acc, int orig) {
+    r_acc = (r_acc * args->m_int + args->b_int) >> 16;
+    if (r_acc > COLOR_R5_MAX) {
+        r_acc = COLOR_R5_MAX;
+    } else if (r_acc < 0) {
+        r_acc = 0;
+    }
+    g_acc = (g_acc * args->m_int + args->b_int * 2) >> 16;
+    if (g_acc > COLOR_G6_MAX) {
+        g_acc = COLOR_G6_MAX;
+    } else if (g_acc < 0) {
+        g_acc = 0;
+    }
+    b_acc = (b_acc * args->m_int + args->b_int) >> 16;
+    if (b_acc > COLOR_B5_MAX) {
+        b_acc = COLOR_B5_MAX;
+    } else if (b_acc < 0) {
+        b_acc = 0;
+    }
+
+    int pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
+
+    if (args->threshold) {
+        if (((COLOR_RGB565_TO_Y(pixel) - args->offset) < COLOR_RGB565_TO_Y(orig)) ^ args->invert) {
+            pixel = COLOR_RGB565_BINARY_MAX;
+        } else {
+            pixel = COLOR_RGB565_BINARY_MIN;
+        }
+    }
+    return pixel;
+}
+
+// Filters row y with the full (2k+1)^2 kernel.
+static void morph_row_general(const morph_args_t *args, int y, uint16_t *buf_row_ptr) {
+    displayio_bitmap_t *bitmap = args->bitmap;
+    const int ksize = args->ksize;
+    const int *krn = args->krn;
+    uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+
+    for (int x = 0, xx = bitmap->width; x < xx; x++) {
+        if (args->mask_row && args->mask_row[x]) {
+            IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
+            continue; // Short circuit.
+        }
+        int32_t r_acc = 0, g_acc = 0, b_acc = 0, ptr = 0;
+
+        if (x >= ksize && x < bitmap->width - ksize && y >= ksize && y < bitmap->height - ksize) {
+            for (int j = -ksize; j <= ksize; j++) {
+                uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y + j);
+                for (int k = -ksize; k <= ksize; k++) {
+                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr, x + k);
+                    r_acc += krn[ptr] * COLOR_RGB565_TO_R5(pixel);
+                    g_acc += krn[ptr] * COLOR_RGB565_TO_G6(pixel);
+                    b_acc += krn[ptr++] * COLOR_RGB565_TO_B5(pixel);
+                }
+            }
+        } else {
+            for (int j = -ksize; j <= ksize; j++) {
+                uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap,
+                    IM_MIN(IM_MAX(y + j, 0), (bitmap->height - 1)));
+                for (int k = -ksize; k <= ksize; k++) {
+                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr,
+                        IM_MIN(IM_MAX(x + k, 0), (bitmap->width - 1)));
+                    r_acc += krn[ptr] * COLOR_RGB565_TO_R5(pixel);
+                    g_acc += krn[ptr] * COLOR_RGB565_TO_G6(pixel);
+                    b_acc += krn[ptr++] * COLOR_RGB565_TO_B5(pixel);
+                }
+            }
+        }
+
+        IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, morph_finish_pixel(args, r_acc, g_acc, b_acc, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x)));
+    }
+}
+
+// Adds weight times each channel of bitmap row y (clamped to the image) to the column sums.
+static void morph_add_row(const morph_args_t *args, int y, int weight) {
+    displayio_bitmap_t *bitmap = args->bitmap;
+    uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, IM_MIN(IM_MAX(y, 0), (bitmap->height - 1)));
+    for (int x = 0, xx = bitmap->width; x < xx; x++) {
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr, x);
+        args->r_col[x] += weight * COLOR_RGB565_TO_R5(pixel);
+        args->g_col[x] += weight * COLOR_RGB565_TO_G6(pixel);
+        args->b_col[x] += weight * COLOR_RGB565_TO_B5(pixel);
+    }
+}
+
+// Filters row y with a separable kernel: the column sums already hold the vertical pass for
+// this row, and the horizontal pass is done here. Edge pixels are clamped in each pass
+// separately, which gives the same result as clamping in the full kernel.
+static void morph_row_separable(const morph_args_t *args, int y, uint16_t *buf_row_ptr) {
+    displayio_bitmap_t *bitmap = args->bitmap;
+    const int ksize = args->ksize;
+    const int last = bitmap->width - 1;
+    const int32_t *r_col = args->r_col, *g_col = args->g_col, *b_col = args->b_col;
+    uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+
+    // Running window sums for box kernels.
+    int32_t r_sum = 0, g_sum = 0, b_sum = 0;
+    if (args->box) {
+        for (int k = -ksize; k <= ksize; k++) {
+            int i = IM_MIN(IM_MAX(k, 0), last);
+            r_sum += r_col[i];
+            g_sum += g_col[i];
+            b_sum += b_col[i];
+        }
+    }
+
+    for (int x = 0, xx = bitmap->width; x < xx; x++) {
+        int32_t r_acc = 0, g_acc = 0, b_acc = 0;
+        if (args->box) {
+            r_acc = r_sum * args->box_weight;
+            g_acc = g_sum * args->box_weight;
+            b_acc = b_sum * args->box_weight;
+            int out = IM_MIN(IM_MAX(x - ksize, 0), last);
+            int in = IM_MIN(x + ksize + 1, last);
+            r_sum += r_col[in] - r_col[out];
+            g_sum += g_col[in] - g_col[out];
+            b_sum += b_col[in] - b_col[out];
+        }
+
+        if (args->mask_row && args->mask_row[x]) {
+            IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
+            continue; // Short circuit.
+        }
+
+        if (!args->box) {
+            const int *row_k = args->row_k;
+            if (x >= ksize && x <= last - ksize) {
+                for (int k = -ksize; k <= ksize; k++) {
+                    int w = row_k[k + ksize];
+                    r_acc += w * r_col[x + k];
+                    g_acc += w * g_col[x + k];
+                    b_acc += w * b_col[x + k];
+                }
+            } else {
+                for (int k = -ksize; k <= ksize; k++) {
+                    int w = row_k[k + ksize];
+                    int i = IM_MIN(IM_MAX(x + k, 0), last);
+                    r_acc += w * r_col[i];
+                    g_acc += w * g_col[i];
+                    b_acc += w * b_col[i];
+                }
+            }
+        }
+
+        IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, morph_finish_pixel(args, r_acc, g_acc, b_acc, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x)));
+    }
+}
+
 void shared_module_bitmapfilter_morph(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
@@ -101,81 +350,75 @@ void shared_module_bitmapfilter_morph(
 
     int brows = ksize + 1;
 
-    const int32_t m_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * m);
-    const int32_t b_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * COLOR_G6_MAX * b);
+    morph_args_t args = {
+        .bitmap = bitmap,
+        .ksize = ksize,
+        .krn = krn,
+        .m_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * m),
+        .b_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * COLOR_G6_MAX * b),
+        .threshold = threshold,
+        .invert = invert,
+        .offset = offset,
+    };
 
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
         case 16: {
+            int n = 2 * ksize + 1;
+            int width = bitmap->width;
+            int col_k[n], row_k[n];
+            bool separable = morph_kernel_separable(n, krn, col_k, row_k);
+            if (separable) {
+                args.col_k = col_k;
+                args.row_k = row_k;
+                args.box = true;
+                for (int i = 1; i < n; i++) {
+                    args.box &= col_k[i] == col_k[0] && row_k[i] == row_k[0];
+                }
+                args.box_weight = col_k[0] * row_k[0];
+            }
+
+            size_t col_size = separable ? 3 * width * sizeof(int32_t) : 0;
             displayio_bitmap_t buf;
-            scratch_bitmap16(&buf, brows, bitmap->width);
+            uint8_t *extra = scratch_bitmap16(&buf, brows, width, col_size + (mask ? width : 0));
+            if (separable) {
+                args.r_col = (int32_t *)extra;
+                args.g_col = args.r_col + width;
+                args.b_col = args.g_col + width;
+                if (args.box) {
+                    // Column sums of the window for row 0; they are updated as the window moves down.
+                    memset(extra, 0, col_size);
+                    for (int j = -ksize; j <= ksize; j++) {
+                        morph_add_row(&args, j, 1);
+                    }
+                }
+            }
+            uint8_t *mask_row = extra + col_size;
 
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
-                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
                 uint16_t *buf_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(&buf, (y % brows));
 
-                for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
-                        continue; // Short circuit.
-
-                    }
-                    int32_t r_acc = 0, g_acc = 0, b_acc = 0, ptr = 0;
+                if (mask) {
+                    morph_mask_row(mask, y, width, mask_row);
+                    args.mask_row = mask_row;
+                }
 
-                    if (x >= ksize && x < bitmap->width - ksize && y >= ksize && y < bitmap->height - ksize) {
-                        for (int j = -ksize; j <= ksize; j++) {
-                            uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y + j);
-                            for (int k = -ksize; k <= ksize; k++) {
-                                int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr, x + k);
-                                r_acc += krn[ptr] * COLOR_RGB565_TO_R5(pixel);
-                                g_acc += krn[ptr] * COLOR_RGB565_TO_G6(pixel);
-                                b_acc += krn[ptr++] * COLOR_RGB565_TO_B5(pixel);
-                            }
-                        }
-                    } else {
+                if (!separable) {
+                    morph_row_general(&args, y, buf_row_ptr);
+                } else {
+                    if (!args.box) {
+                        memset(extra, 0, col_size);
                         for (int j = -ksize; j <= ksize; j++) {
-                            uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap,
-                                IM_MIN(IM_MAX(y + j, 0), (bitmap->height - 1)));
-                            for (int k = -ksize; k <= ksize; k++) {
-                                int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr,
-                                    IM_MIN(IM_MAX(x + k, 0), (bitmap->width - 1)));
-                                r_acc += krn[ptr] * COLOR_RGB565_TO_R5(pixel);
-                                g_acc += krn[ptr] * COLOR_RGB565_TO_G6(pixel);
-                                b_acc += krn[ptr++] * COLOR_RGB565_TO_B5(pixel);
-                            }
+                            morph_add_row(&args, y + j, col_k[j + ksize]);
                         }
                     }
-                    r_acc = (r_acc * m_int + b_int) >> 16;
-                    if (r_acc > COLOR_R5_MAX) {
-                        r_acc = COLOR_R5_MAX;
-                    } else if (r_acc < 0) {
-                        r_acc = 0;
+                    morph_row_separable(&args, y, buf_row_ptr);
+                    if (args.box) {
+                        // Slide the window down one row, before its top row is overwritten below.
+                        morph_add_row(&args, y - ksize, -1);
+                        morph_add_row(&args, y + ksize + 1, 1);
                     }
-                    g_acc = (g_acc * m_int + b_int * 2) >> 16;
-                    if (g_acc > COLOR_G6_MAX) {
-                        g_acc = COLOR_G6_MAX;
-                    } else if (g_acc < 0) {
-                        g_acc = 0;
-                    }
-                    b_acc = (b_acc * m_int + b_int) >> 16;
-                    if (b_acc > COLOR_B5_MAX) {
-                        b_acc = COLOR_B5_MAX;
-                    } else if (b_acc < 0) {
-                        b_acc = 0;
-                    }
-
-                    int pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
-
-                    if (threshold) {
-                        if (((COLOR_RGB565_TO_Y(pixel) - offset) < COLOR_RGB565_TO_Y(IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x))) ^ invert) {
-                            pixel = COLOR_RGB565_BINARY_MAX;
-                        } else {
-                            pixel = COLOR_RGB565_BINARY_MIN;
-                        }
-                    }
-
-                    IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, pixel);
                 }
 
                 if (y >= ksize) {     // Transfer buffer lines...
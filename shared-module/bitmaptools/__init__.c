@@ -1034,6 +1034,134 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Row-level pixel access for blit. Rows and clipping are computed by the caller, so unlike
+// common_hal_displayio_bitmap_get_pixel these do no bounds checks.
+static inline uint32_t blit_get(const displayio_bitmap_t *bitmap, const uint32_t *row, int x) {
+    switch (bitmap->bits_per_value) {
+        case 32:
+            return row[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 8:
+            return ((const uint8_t *)row)[x];
+        default: {
+            uint8_t values_per_byte = 8 / bitmap->bits_per_value;
+            uint8_t bit_position = (values_per_byte - (x & bitmap->x_mask) - 1) * bitmap->bits_per_value;
+            return (((const uint8_t *)row)[x >> bitmap->x_shift] >> bit_position) & bitmap->bitmask;
+        }
+    }
+}
+
+static inline void blit_set(const displayio_bitmap_t *bitmap, uint32_t *row, int x, uint32_t value) {
+    switch (bitmap->bits_per_value) {
+        case 32:
+            row[x] = value;
+            break;
+        case 16:
+            ((uint16_t *)row)[x] = value;
+            break;
+        case 8:
+            ((uint8_t *)row)[x] = value;
+            break;
+        default: {
+            uint8_t values_per_byte = 8 / bitmap->bits_per_value;
+            uint8_t bit_position = (values_per_byte - (x & bitmap->x_mask) - 1) * bitmap->bits_per_value;
+            uint8_t *b = &((uint8_t *)row)[x >> bitmap->x_shift];
+            *b = (*b & ~(bitmap->bitmask << bit_position)) | ((value & bitmap->bitmask) << bit_position);
+            break;
+        }
+    }
+}
+
+typedef struct {
+    const displayio_bitmap_t *source;
+    displayio_bitmap_t *destination;
+    int xs; // first source column
+    int xd; // first destination column
+    int width;
+    uint32_t skip_source_index;
+    uint32_t skip_dest_index;
+    bool skip_source_index_none;
+    bool skip_dest_index_none;
+} blit_row_args_t;
+
+// Copies columns [start, end) of a row one pixel at a time, for mixed depths, unaligned
+// sub-byte pixels and right-to-left copies within one row.
+static void blit_row_pixels(const blit_row_args_t *a, const uint32_t *src_row, uint32_t *dst_row, int start, int end, bool reverse) {
+    for (int n = start; n < end; n++) {
+        int i = reverse ? end - 1 - (n - start) : n;
+        uint32_t value = blit_get(a->source, src_row, a->xs + i);
+        if (!a->skip_source_index_none && value == a->skip_source_index) {
+            continue;
+        }
+        if (!a->skip_dest_index_none && blit_get(a->destination, dst_row, a->xd + i) == a->skip_dest_index) {
+            continue;
+        }
+        blit_set(a->destination, dst_row, a->xd + i, value);
+    }
+}
+
+#define BLIT_ROW_TYPED(type, a, src_row, dst_row) do { \
+        const type *s = (const type *)(src_row) + (a)->xs; \
+        type *d = (type *)(dst_row) + (a)->xd; \
+        for (int i = 0; i < (a)->width; i++) { \
+            type value = s[i]; \
+            if (((a)->skip_source_index_none || value != (a)->skip_source_index) && \
+                ((a)->skip_dest_index_none || d[i] != (a)->skip_dest_index)) { \
+                d[i] = value; \
+            } \
+        } \
+} while (0)
+
+// Returns a mask with all bits of each bits_per_value wide field of v set if that field is
+// non-zero, so a byte of packed pixels can be compared against an index in one go.
+static inline uint8_t blit_nonzero_fields(uint8_t v, uint8_t bits_per_value, uint8_t field_lsbs, uint8_t bitmask) {
+    uint8_t t = v;
+    for (uint8_t k = 1; k < bits_per_value; k++) {
+        t |= v >> k;
+    }
+    return (uint8_t)((t & field_lsbs) * bitmask);
+}
+
+// Same depth, with source and destination pixels at the same position within their bytes.
+// Whole bytes in the middle of the row are copied (or masked) several pixels at a time.
+static void blit_row_packed(const blit_row_args_t *a, const uint32_t *src_row, uint32_t *dst_row) {
+    const displayio_bitmap_t *bitmap = a->destination;
+    uint8_t values_per_byte = 8 / bitmap->bits_per_value;
+    int head = (values_per_byte - (a->xd & bitmap->x_mask)) & bitmap->x_mask;
+    if (head > a->width) {
+        head = a->width;
+    }
+    int bytes = (a->width - head) / values_per_byte;
+    int tail_start = head + bytes * values_per_byte;
+
+    blit_row_pixels(a, src_row, dst_row, 0, head, false);
+
+    const uint8_t *s = (const uint8_t *)src_row + ((a->xs + head) >> bitmap->x_shift);
+    uint8_t *d = (uint8_t *)dst_row + ((a->xd + head) >> bitmap->x_shift);
+    bool skip_source = !a->skip_source_index_none && a->skip_source_index <= bitmap->bitmask;
+    bool skip_dest = !a->skip_dest_index_none && a->skip_dest_index <= bitmap->bitmask;
+    if (!skip_source && !skip_dest) {
+        memmove(d, s, bytes);
+    } else {
+        uint8_t field_lsbs = 0xff / bitmap->bitmask;
+        uint8_t source_skip_bytes = a->skip_source_index * field_lsbs;
+        uint8_t dest_skip_bytes = a->skip_dest_index * field_lsbs;
+        for (int i = 0; i < bytes; i++) {
+            uint8_t mask = 0xff;
+            if (skip_source) {
+                mask &= blit_nonzero_fields(s[i] ^ source_skip_bytes, bitmap->bits_per_value, field_lsbs, bitmap->bitmask);
+            }
+            if (skip_dest) {
+                mask &= blit_nonzero_fields(d[i] ^ dest_skip_bytes, bitmap->bits_per_value, field_lsbs, bitmap->bitmask);
+            }
+            d[i] = (d[i] & ~mask) | (s[i] & mask);
+        }
+    }
+
+    blit_row_pixels(a, src_row, dst_row, tail_start, a->width, false);
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1046,58 +1174,78 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     // If skip_value is `None`, then all pixels are copied.
     // This function assumes input checks were performed for pixel index entries.
 
-    // Update the dirty area
-    int16_t dirty_x_max = (x + (x2 - x1));
-    if (dirty_x_max > destination->width) {
-        dirty_x_max = destination->width;
+    // Clip the region to both bitmaps once, so the copy loops don't have to check each pixel.
+    int xd = x, yd = y, xs = x1, ys = y1;
+    if (xd < 0) {
+        xs -= xd;
+        xd = 0;
     }
-    int16_t dirty_y_max = y + (y2 - y1);
-    if (dirty_y_max > destination->height) {
-        dirty_y_max = destination->height;
+    if (yd < 0) {
+        ys -= yd;
+        yd = 0;
     }
-
-    displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
-    displayio_bitmap_set_dirty_area(destination, &a);
-
-    bool x_reverse = false;
-    bool y_reverse = false;
-
-    // Add reverse direction option to protect blitting of destination bitmap back into destination bitmap
-    if (x > x1) {
-        x_reverse = true;
+    if (xs < 0) {
+        xd -= xs;
+        xs = 0;
+    }
+    if (ys < 0) {
+        yd -= ys;
+        ys = 0;
     }
-    if (y > y1) {
-        y_reverse = true;
+    int width = MIN(MIN(x2, source->width) - xs, destination->width - xd);
+    int height = MIN(MIN(y2, source->height) - ys, destination->height - yd);
+    if (width <= 0 || height <= 0) {
+        return;
     }
 
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
-                    }
-                }
+    // Update the dirty area
+    displayio_area_t area = { xd, yd, xd + width, yd + height, NULL};
+    displayio_bitmap_set_dirty_area(destination, &area);
+
+    blit_row_args_t args = {
+        .source = source,
+        .destination = destination,
+        .xs = xs,
+        .xd = xd,
+        .width = width,
+        .skip_source_index = skip_source_index,
+        .skip_dest_index = skip_dest_index,
+        .skip_source_index_none = skip_source_index_none,
+        .skip_dest_index_none = skip_dest_index_none,
+    };
+
+    // Blitting a bitmap into itself: walk rows bottom-up when moving down, and pixels
+    // right-to-left when moving right within the same rows, so the source isn't
+    // overwritten before it is read.
+    bool bottom_up = source == destination && yd > ys;
+    bool right_to_left = source == destination && yd == ys && xd > xs;
+
+    uint8_t bits_per_value = destination->bits_per_value;
+    bool same_depth = source->bits_per_value == bits_per_value;
+    bool skip_none = skip_source_index_none && skip_dest_index_none;
+
+    for (int j = 0; j < height; j++) {
+        int row = bottom_up ? height - 1 - j : j;
+        const uint32_t *src_row = source->data + (ys + row) * source->stride;
+        uint32_t *dst_row = destination->data + (yd + row) * destination->stride;
+
+        if (right_to_left || !same_depth) {
+            blit_row_pixels(&args, src_row, dst_row, 0, width, right_to_left);
+        } else if (bits_per_value < 8) {
+            if ((xs & destination->x_mask) == (xd & destination->x_mask)) {
+                blit_row_packed(&args, src_row, dst_row);
+            } else {
+                blit_row_pixels(&args, src_row, dst_row, 0, width, false);
             }
+        } else if (skip_none) {
+            size_t bytes_per_value = bits_per_value / 8;
+            memmove((uint8_t *)dst_row + xd * bytes_per_value, (const uint8_t *)src_row + xs * bytes_per_value, width * bytes_per_value);
+        } else if (bits_per_value == 8) {
+            BLIT_ROW_TYPED(uint8_t, &args, src_row, dst_row);
+        } else if (bits_per_value == 16) {
+            BLIT_ROW_TYPED(uint16_t, &args, src_row, dst_row);
+        } else {
+            BLIT_ROW_TYPED(uint32_t, &args, src_row, dst_row);
         }
     }
 }
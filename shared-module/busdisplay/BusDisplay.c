@@ -196,6 +196,10 @@ mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_o
     return self->core.current_group;
 }
 
+// Estimated cost, in pixels, of refreshing one more area: the set window and write RAM commands
+// plus rendering setup.
+#define BUSDISPLAY_AREA_OVERHEAD (64)
+
 static const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
@@ -311,7 +315,11 @@ static void _refresh_display(busdisplay_busdisplay_obj_t *self) {
         return;
     }
     displayio_display_core_start_refresh(&self->core);
-    const displayio_area_t *current_area = _get_refresh_areas(self);
+    // Merge overlapping and nearby areas so that no pixel is rendered twice and small neighboring
+    // areas share one set of window commands.
+    displayio_area_t merged_areas[CIRCUITPY_DISPLAY_MERGED_AREAS];
+    const displayio_area_t *current_area = displayio_display_core_merge_areas(&self->core, _get_refresh_areas(self),
+        merged_areas, CIRCUITPY_DISPLAY_MERGED_AREAS, BUSDISPLAY_AREA_OVERHEAD);
     while (current_area != NULL) {
         _refresh_area(self, current_area);
         current_area = current_area->next;
@@ -464,3 +464,84 @@ displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, dis
 
     return tail;
 }
+
+// Finds the TileGrid that may be scrolled. Returns false if more than one could be.
+static bool _find_scroll(displayio_group_t *self, const displayio_area_t *clip, displayio_tilegrid_scroll_t *scroll) {
+    for (size_t i = 0; i < self->members->len; i++) {
+        mp_obj_t layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_tilegrid_scroll_t candidate;
+            if (displayio_tilegrid_get_scroll(layer, clip, &candidate)) {
+                if (scroll->tilegrid != NULL) {
+                    return false;
+                }
+                *scroll = candidate;
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            if (!_find_scroll(layer, clip, scroll)) {
+                return false;
+            }
+            continue;
+        }
+    }
+    return true;
+}
+
+// Returns true if anything besides the scrolled TileGrid was or will be drawn within area.
+static bool _scroll_blocked(displayio_group_t *self, const displayio_tilegrid_t *scrolled, const displayio_area_t *area) {
+    displayio_area_t overlap;
+    if (self->item_removed && displayio_area_compute_overlap(&self->dirty_area, area, &overlap)) {
+        return true;
+    }
+    for (size_t i = 0; i < self->members->len; i++) {
+        mp_obj_t layer;
+        #if CIRCUITPY_VECTORIO
+        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
+        if (draw_protocol != NULL) {
+            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
+            displayio_area_t shape_area;
+            if (draw_protocol->draw_protocol_impl->draw_get_dirty_area(layer, &shape_area) &&
+                displayio_area_compute_overlap(&shape_area, area, &overlap)) {
+                return true;
+            }
+            continue;
+        }
+        #endif
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            if (layer != scrolled && displayio_tilegrid_overlaps(layer, area)) {
+                return true;
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            if (_scroll_blocked(layer, scrolled, area)) {
+                return true;
+            }
+            continue;
+        }
+    }
+    return false;
+}
+
+bool displayio_group_get_scroll(displayio_group_t *self, const displayio_area_t *clip, displayio_tilegrid_scroll_t *scroll) {
+    scroll->tilegrid = NULL;
+    if (!_find_scroll(self, clip, scroll) || scroll->tilegrid == NULL) {
+        return false;
+    }
+    // Other layers, above or below, would be moved along with the copied pixels.
+    displayio_area_t source;
+    displayio_area_copy(&scroll->dest, &source);
+    displayio_area_shift(&source, -scroll->dx, -scroll->dy);
+    displayio_area_t affected;
+    displayio_area_union(&scroll->dest, &source, &affected);
+    return !_scroll_blocked(self, scroll->tilegrid, &affected);
+}
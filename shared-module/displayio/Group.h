@@ -13,6 +13,7 @@
 #include "py/objlist.h"
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
+#include "shared-module/displayio/TileGrid.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -37,3 +38,6 @@ bool displayio_group_fill_area(displayio_group_t *group, const _displayio_colors
 void displayio_group_update_transform(displayio_group_t *group, const displayio_buffer_transform_t *parent_transform);
 void displayio_group_finish_refresh(displayio_group_t *self);
 displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_t *tail);
+// Fills in scroll when exactly one TileGrid only scrolled since the last frame and no other layer
+// is drawn where its pixels would be copied from or to.
+bool displayio_group_get_scroll(displayio_group_t *self, const displayio_area_t *clip, displayio_tilegrid_scroll_t *scroll);
@@ -294,29 +294,41 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     } else {
         ((uint8_t *)tiles)[index] = (uint8_t)tile_index;
     }
-    displayio_area_t temp_area;
-    displayio_area_t *tile_area;
-    if (!self->partial_change) {
-        tile_area = &self->dirty_area;
-    } else {
-        tile_area = &temp_area;
-    }
+    displayio_area_t tile_area;
     int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
+    tile_area.x1 = tx * self->tile_width;
+    tile_area.x2 = tile_area.x1 + self->tile_width;
     int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
+    tile_area.y1 = ty * self->tile_height;
+    tile_area.y2 = tile_area.y1 + self->tile_height;
 
-    if (self->partial_change) {
-        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
+    if (!self->partial_change) {
+        self->dirty_area_count = 0;
+    }
+    // Neighboring tiles are combined as long as that adds no unchanged pixels. Separate changes,
+    // such as a status line and a cursor, are kept apart until all of the areas are used.
+    size_t count = self->dirty_area_count;
+    if (!displayio_area_add_merged(self->dirty_areas, &count, CIRCUITPY_TILEGRID_DIRTY_AREAS, &tile_area, 0)) {
+        size_t best = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for (size_t i = 0; i < count; i++) {
+            displayio_area_t u;
+            displayio_area_union(&tile_area, &self->dirty_areas[i], &u);
+            uint32_t growth = displayio_area_size(&u) - displayio_area_size(&self->dirty_areas[i]);
+            if (growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        displayio_area_union(&self->dirty_areas[best], &tile_area, &self->dirty_areas[best]);
     }
+    self->dirty_area_count = count;
 
     self->partial_change = true;
 }
@@ -409,7 +421,103 @@ bool common_hal_displayio_tilegrid_contains(displayio_tilegrid_t *self, uint16_t
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
     self->top_left_x = x;
     self->top_left_y = y;
-    self->full_change = true;
+    // The change itself is found by comparing against the rendered top left. Tiles set before now
+    // have a dirty area relative to the old top left though so redraw everything.
+    if (self->partial_change) {
+        self->full_change = true;
+    }
+}
+
+static bool _top_left_changed(displayio_tilegrid_t *self) {
+    return self->top_left_x != self->rendered_top_left_x || self->top_left_y != self->rendered_top_left_y;
+}
+
+// Returns the shortest tile offset, in either direction, from before to now with wrap around.
+static int16_t _wrapped_delta(uint16_t now, uint16_t before, uint16_t count) {
+    int32_t delta = (int32_t)(now % count) - (int32_t)(before % count);
+    if (delta > count / 2) {
+        delta -= count;
+    } else if (delta < -(count / 2)) {
+        delta += count;
+    }
+    return delta;
+}
+
+bool displayio_tilegrid_get_scroll(displayio_tilegrid_t *self, const displayio_area_t *clip, displayio_tilegrid_scroll_t *scroll) {
+    bool first_draw = self->previous_area.x1 == self->previous_area.x2;
+    bool hidden = self->hidden || self->hidden_by_parent;
+    if (first_draw || hidden || self->full_change || (!self->moved && !_top_left_changed(self))) {
+        return false;
+    }
+    // Only a plain one to one mapping of pixels can be copied.
+    const displayio_buffer_transform_t *transform = self->absolute_transform;
+    if (transform == NULL || transform->dx != 1 || transform->dy != 1 || transform->scale != 1 ||
+        transform->transpose_xy || self->flip_x || self->flip_y || self->transpose_xy) {
+        return false;
+    }
+    if (displayio_area_width(&self->previous_area) != self->pixel_width ||
+        displayio_area_height(&self->previous_area) != self->pixel_height) {
+        return false;
+    }
+    // Any change to the pixels themselves needs a full redraw.
+    if ((mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+         displayio_bitmap_get_refresh_areas(self->bitmap, NULL) != NULL) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+         displayio_palette_needs_refresh(self->pixel_shader)) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+         displayio_colorconverter_needs_refresh(self->pixel_shader))) {
+        return false;
+    }
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type) &&
+        tilepalettemapper_tilepalettemapper_needs_refresh(self->pixel_shader)) {
+        return false;
+    }
+    #endif
+
+    // The pixel at local x, y now shows what was shown at x + shift_x, y + shift_y.
+    int16_t shift_x = _wrapped_delta(self->top_left_x, self->rendered_top_left_x, self->width_in_tiles) * self->tile_width;
+    int16_t shift_y = _wrapped_delta(self->top_left_y, self->rendered_top_left_y, self->height_in_tiles) * self->tile_height;
+    scroll->dx = self->current_area.x1 - self->previous_area.x1 - shift_x;
+    scroll->dy = self->current_area.y1 - self->previous_area.y1 - shift_y;
+    if (scroll->dx == 0 && scroll->dy == 0) {
+        return false;
+    }
+
+    // Only the part of the grid that doesn't wrap around was shown before.
+    displayio_area_t dest = {
+        .x1 = self->current_area.x1 + MAX(0, -shift_x),
+        .y1 = self->current_area.y1 + MAX(0, -shift_y),
+        .x2 = self->current_area.x2 - MAX(0, shift_x),
+        .y2 = self->current_area.y2 - MAX(0, shift_y),
+        .next = NULL,
+    };
+    // Both the source and the destination must be within clip.
+    displayio_area_t shifted_clip;
+    displayio_area_copy(clip, &shifted_clip);
+    displayio_area_shift(&shifted_clip, scroll->dx, scroll->dy);
+    if (displayio_area_empty(&dest) ||
+        !displayio_area_compute_overlap(&dest, clip, &dest) ||
+        !displayio_area_compute_overlap(&dest, &shifted_clip, &dest)) {
+        return false;
+    }
+    displayio_area_copy(&dest, &scroll->dest);
+    scroll->tilegrid = self;
+    return true;
+}
+
+void displayio_tilegrid_set_scrolled(displayio_tilegrid_t *self) {
+    self->scrolled = true;
+}
+
+bool displayio_tilegrid_overlaps(displayio_tilegrid_t *self, const displayio_area_t *area) {
+    displayio_area_t overlap;
+    if (displayio_tilegrid_get_previous_area(self, &overlap) &&
+        displayio_area_compute_overlap(&overlap, area, &overlap)) {
+        return true;
+    }
+    bool hidden = self->hidden || self->hidden_by_parent;
+    return !hidden && self->in_group && displayio_area_compute_overlap(&self->current_area, area, &overlap);
 }
 
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
@@ -608,6 +716,10 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
+    self->dirty_area_count = 0;
+    self->scrolled = false;
+    self->rendered_top_left_x = self->top_left_x;
+    self->rendered_top_left_y = self->top_left_y;
     if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -628,6 +740,50 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts an area of changed tiles from tile grid pixels to screen coordinates.
+static void _make_dirty_area_absolute(displayio_tilegrid_t *self, displayio_area_t *dirty_area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = dirty_area->x1;
+    int16_t x2 = dirty_area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = dirty_area->y1;
+    int16_t y2 = dirty_area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    dirty_area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    dirty_area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    dirty_area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    dirty_area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (dirty_area->y2 < dirty_area->y1) {
+        int16_t temp = dirty_area->y2;
+        dirty_area->y2 = dirty_area->y1;
+        dirty_area->y1 = temp;
+    }
+    if (dirty_area->x2 < dirty_area->x1) {
+        int16_t temp = dirty_area->x2;
+        dirty_area->x2 = dirty_area->x1;
+        dirty_area->x1 = temp;
+    }
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -640,11 +796,12 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         } else {
             return tail;
         }
-    } else if (self->moved && !first_draw) {
-        displayio_area_union(&self->previous_area, &self->current_area, &self->dirty_area);
-        if (displayio_area_size(&self->dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
-            self->dirty_area.next = tail;
-            return &self->dirty_area;
+    } else if (self->moved && !first_draw && !self->scrolled) {
+        displayio_area_t *dirty_area = &self->dirty_areas[0];
+        displayio_area_union(&self->previous_area, &self->current_area, dirty_area);
+        if (displayio_area_size(dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
+            dirty_area->next = tail;
+            return dirty_area;
         }
         self->previous_area.next = tail;
         self->current_area.next = &self->previous_area;
@@ -658,7 +815,8 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             // Special case a TileGrid that shows a full bitmap and use its
             // dirty area. Copy it to ours so we can transform it.
             if (self->tiles_in_bitmap == 1) {
-                displayio_area_copy(refresh_area, &self->dirty_area);
+                displayio_area_copy(refresh_area, &self->dirty_areas[0]);
+                self->dirty_area_count = 1;
                 self->partial_change = true;
             } else {
                 self->full_change = true;
@@ -677,55 +835,18 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             tilepalettemapper_tilepalettemapper_needs_refresh(self->pixel_shader));
     #endif
 
-    if (self->full_change || first_draw) {
+    // When the display scrolled our pixels then only tiles set since need an update.
+    if (self->full_change || first_draw || (_top_left_changed(self) && !self->scrolled)) {
         self->current_area.next = tail;
         return &self->current_area;
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
+        for (int16_t i = self->dirty_area_count - 1; i >= 0; i--) {
+            _make_dirty_area_absolute(self, &self->dirty_areas[i]);
+            self->dirty_areas[i].next = tail;
+            tail = &self->dirty_areas[i];
         }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
-        self->dirty_area.next = tail;
-        return &self->dirty_area;
     }
     return tail;
 }
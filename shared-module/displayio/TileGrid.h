@@ -30,9 +30,13 @@ typedef struct {
     uint16_t tile_height;
     uint16_t top_left_x;
     uint16_t top_left_y;
+    uint16_t rendered_top_left_x; // top_left_x and top_left_y as of the last refresh.
+    uint16_t rendered_top_left_y;
+    uint8_t dirty_area_count;
     void *tiles;  // Can be either uint8_t* or uint16_t* depending on tiles_in_bitmap
     const displayio_buffer_transform_t *absolute_transform;
-    displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    // Changed tiles. Stored as relative areas until the refresh areas are fetched.
+    displayio_area_t dirty_areas[CIRCUITPY_TILEGRID_DIRTY_AREAS];
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
     bool partial_change : 1;
@@ -46,9 +50,19 @@ typedef struct {
     bool hidden : 1;
     bool hidden_by_parent : 1;
     bool rendered_hidden : 1;
-    uint8_t padding : 6;
+    bool scrolled : 1; // The display moved our previous pixels instead of redrawing them.
+    uint8_t padding : 5;
 } displayio_tilegrid_t;
 
+// Describes how the pixels of a TileGrid that only scrolled can be reused. The pixels that are
+// now in dest were shown dx, dy pixels earlier (dest shifted by -dx, -dy) in the last frame.
+typedef struct {
+    displayio_tilegrid_t *tilegrid;
+    displayio_area_t dest;
+    int16_t dx;
+    int16_t dy;
+} displayio_tilegrid_scroll_t;
+
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
 
 // Updating the screen is a three stage process.
@@ -66,5 +80,15 @@ void displayio_tilegrid_update_transform(displayio_tilegrid_t *group, const disp
 bool displayio_tilegrid_get_previous_area(displayio_tilegrid_t *self, displayio_area_t *area);
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self);
 
+// Fills in scroll when the only change since the last frame is a move or a top_left change that
+// a display can do by copying pixels within clip. Only the visible grid area is checked; the
+// caller must make sure no other layer is drawn in the same place.
+bool displayio_tilegrid_get_scroll(displayio_tilegrid_t *self, const displayio_area_t *clip, displayio_tilegrid_scroll_t *scroll);
+// Called by the display after it copied the pixels described by get_scroll so that only the
+// remaining changes are refreshed.
+void displayio_tilegrid_set_scrolled(displayio_tilegrid_t *self);
+// Returns true if the tilegrid was drawn within area last frame or will be drawn there next.
+bool displayio_tilegrid_overlaps(displayio_tilegrid_t *self, const displayio_area_t *area);
+
 bool displayio_tilegrid_get_rendered_hidden(displayio_tilegrid_t *self);
 void displayio_tilegrid_validate_pixel_shader(mp_obj_t pixel_shader);
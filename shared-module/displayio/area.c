@@ -6,6 +6,8 @@
 
 #include "shared-module/displayio/area.h"
 
+#include <string.h>
+
 #include "py/misc.h"
 
 void displayio_area_copy(const displayio_area_t *src, displayio_area_t *dst) {
@@ -139,3 +141,109 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Adds area to the *count areas in areas. overhead is the cost of refreshing an extra area in
+// pixels (for example the bus commands to set a window). Areas are replaced by their bounding box
+// when that is no more expensive than refreshing both, counting any overlap twice. Returns false
+// when area needs to be kept separate but max_count areas are already stored.
+bool displayio_area_add_merged(displayio_area_t *areas, size_t *count, size_t max_count,
+    const displayio_area_t *area, uint32_t overhead) {
+    if (displayio_area_empty(area)) {
+        return true;
+    }
+    displayio_area_t current;
+    displayio_area_copy(area, &current);
+    while (true) {
+        // Find the area that the current one is best combined with.
+        size_t best = *count;
+        uint32_t best_growth = UINT32_MAX;
+        for (size_t i = 0; i < *count; i++) {
+            displayio_area_t u;
+            displayio_area_union(&current, &areas[i], &u);
+            uint32_t growth = displayio_area_size(&u) - displayio_area_size(&areas[i]);
+            if (growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        if (best == *count || best_growth > displayio_area_size(&current) + overhead) {
+            if (*count == max_count) {
+                return false;
+            }
+            areas[(*count)++] = current;
+            return true;
+        }
+        // The bounding box may now be worth merging with others so add it again.
+        displayio_area_union(&current, &areas[best], &current);
+        areas[best] = areas[--(*count)];
+    }
+}
+
+// Stores the parts of a that are outside of b in pieces and returns how many there are. Full
+// width bands above and below come first so that the pieces are as wide as possible.
+size_t displayio_area_subtract(const displayio_area_t *a, const displayio_area_t *b, displayio_area_t *pieces) {
+    displayio_area_t overlap;
+    if (!displayio_area_compute_overlap(a, b, &overlap)) {
+        pieces[0] = *a;
+        return 1;
+    }
+    size_t count = 0;
+    if (a->y1 < overlap.y1) {
+        pieces[count++] = (displayio_area_t) {a->x1, a->y1, a->x2, overlap.y1, NULL};
+    }
+    if (overlap.y2 < a->y2) {
+        pieces[count++] = (displayio_area_t) {a->x1, overlap.y2, a->x2, a->y2, NULL};
+    }
+    if (a->x1 < overlap.x1) {
+        pieces[count++] = (displayio_area_t) {a->x1, overlap.y1, overlap.x1, overlap.y2, NULL};
+    }
+    if (overlap.x2 < a->x2) {
+        pieces[count++] = (displayio_area_t) {overlap.x2, overlap.y1, a->x2, overlap.y2, NULL};
+    }
+    return count;
+}
+
+#define AREA_MAX_PIECES (8)
+
+// Cuts areas that still overlap earlier ones (such as the two arms of an L shape that weren't worth
+// merging) into pieces so that no pixel is refreshed twice. An area is only cut when the pieces
+// cost less than the whole area and they fit in max_count. Returns the new count.
+size_t displayio_area_remove_overlaps(displayio_area_t *areas, size_t count, size_t max_count, uint32_t overhead) {
+    for (size_t i = 1; i < count; i++) {
+        displayio_area_t pieces[AREA_MAX_PIECES];
+        size_t piece_count = 1;
+        pieces[0] = areas[i];
+        for (size_t j = 0; j < i && piece_count > 0; j++) {
+            displayio_area_t remaining[AREA_MAX_PIECES];
+            size_t remaining_count = 0;
+            size_t k = 0;
+            for (; k < piece_count && remaining_count + 4 <= AREA_MAX_PIECES; k++) {
+                remaining_count += displayio_area_subtract(&pieces[k], &areas[j], remaining + remaining_count);
+            }
+            if (k < piece_count) {
+                // Too complicated so leave this area whole.
+                piece_count = 1;
+                pieces[0] = areas[i];
+                break;
+            }
+            memcpy(pieces, remaining, remaining_count * sizeof(displayio_area_t));
+            piece_count = remaining_count;
+        }
+        if (piece_count == 1 && displayio_area_equal(&pieces[0], &areas[i])) {
+            continue;
+        }
+        uint32_t pieces_cost = 0;
+        for (size_t k = 0; k < piece_count; k++) {
+            pieces_cost += displayio_area_size(&pieces[k]) + overhead;
+        }
+        if (pieces_cost >= displayio_area_size(&areas[i]) + overhead || count - 1 + piece_count > max_count) {
+            continue;
+        }
+        // Replace the area with the pieces, which don't overlap any earlier area, and skip over them.
+        memmove(&areas[i + piece_count], &areas[i + 1], (count - i - 1) * sizeof(displayio_area_t));
+        memcpy(&areas[i], pieces, piece_count * sizeof(displayio_area_t));
+        count = count - 1 + piece_count;
+        i = i + piece_count - 1;
+    }
+    return count;
+}
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 // Implementations are in area.c
 typedef struct _displayio_area_t displayio_area_t;
@@ -55,3 +56,7 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
     const displayio_area_t *original,
     const displayio_area_t *whole,
     displayio_area_t *transformed);
+bool displayio_area_add_merged(displayio_area_t *areas, size_t *count, size_t max_count,
+    const displayio_area_t *area, uint32_t overhead);
+size_t displayio_area_subtract(const displayio_area_t *a, const displayio_area_t *b, displayio_area_t *pieces);
+size_t displayio_area_remove_overlaps(displayio_area_t *areas, size_t count, size_t max_count, uint32_t overhead);
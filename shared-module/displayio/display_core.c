@@ -8,7 +8,6 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "supervisor/shared/display.h"
@@ -203,3 +202,28 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// Clips the linked list of areas to the display and merges them into at most max_count areas
+// stored in merged, cutting up ones that still overlap when that is cheaper. overhead is the
+// estimated cost of refreshing an additional area in pixels. Returns the first merged area, NULL
+// if nothing is visible or the original list when there are too many separate areas.
+const displayio_area_t *displayio_display_core_merge_areas(displayio_display_core_t *self, const displayio_area_t *areas,
+    displayio_area_t *merged, size_t max_count, uint32_t overhead) {
+    size_t count = 0;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        displayio_area_t clipped;
+        if (displayio_display_core_clip_area(self, area, &clipped) &&
+            !displayio_area_add_merged(merged, &count, max_count, &clipped, overhead)) {
+            return areas;
+        }
+    }
+    if (count == 0) {
+        return NULL;
+    }
+    count = displayio_area_remove_overlaps(merged, count, max_count, overhead);
+    for (size_t i = 0; i < count - 1; i++) {
+        merged[i].next = &merged[i + 1];
+    }
+    merged[count - 1].next = NULL;
+    return merged;
+}
@@ -51,3 +51,5 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
+const displayio_area_t *displayio_display_core_merge_areas(displayio_display_core_t *self, const displayio_area_t *areas,
+    displayio_area_t *merged, size_t max_count, uint32_t overhead);
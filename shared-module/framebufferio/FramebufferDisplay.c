@@ -9,7 +9,6 @@
 
 #include "py/gc.h"
 #include "py/runtime.h"
-#include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
@@ -105,17 +104,65 @@ mp_obj_t common_hal_framebufferio_framebufferdisplay_get_framebuffer(framebuffer
     return self->framebuffer;
 }
 
-static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdisplay_obj_t *self) {
+// Estimated cost, in pixels, of refreshing one more area. There are no bus commands so this is
+// only the rendering setup.
+#define FRAMEBUFFERDISPLAY_AREA_OVERHEAD (32)
+
+static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdisplay_obj_t *self, displayio_area_t *tail) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_group_get_refresh_areas(self->core.current_group, tail);
     }
     return NULL;
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
+
+// Up to four pieces each of the TileGrid area outside the copy and of the area it left.
+#define FRAMEBUFFERDISPLAY_SCROLL_AREAS (8)
+
+// Scrolls a TileGrid by moving its pixels within the framebuffer instead of redrawing them. Sets
+// exposed_list to the areas, stored in exposed, that the move left behind or uncovered and that
+// still need to be drawn. Returns false if nothing was moved.
+static bool _scroll(framebufferio_framebufferdisplay_obj_t *self, displayio_area_t *exposed,
+    displayio_area_t **exposed_list, uint8_t *dirty_row_bitmask) {
+    *exposed_list = NULL;
+    if (self->core.full_refresh || self->core.current_group == NULL || self->core.colorspace.depth % 8 != 0) {
+        return false;
+    }
+    displayio_tilegrid_scroll_t scroll;
+    if (!displayio_group_get_scroll(self->core.current_group, &self->core.area, &scroll)) {
+        return false;
+    }
+
+    size_t bytes_per_pixel = self->core.colorspace.depth / 8;
+    size_t rowstride = self->row_stride;
+    size_t rowsize = displayio_area_width(&scroll.dest) * bytes_per_pixel;
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf + self->first_pixel_offset;
+    ptrdiff_t offset = scroll.dy * (ptrdiff_t)rowstride + scroll.dx * (ptrdiff_t)bytes_per_pixel;
+    // Copy rows in the direction of the move so that no row is overwritten before it is copied.
+    int16_t first = scroll.dy > 0 ? scroll.dest.y2 - 1 : scroll.dest.y1;
+    int16_t step = scroll.dy > 0 ? -1 : 1;
+    for (int16_t i = 0, y = first; i < displayio_area_height(&scroll.dest); i++, y += step) {
+        uint8_t *dest = buf + y * rowstride + scroll.dest.x1 * bytes_per_pixel;
+        memmove(dest, dest - offset, rowsize);
+        MARK_ROW_DIRTY(y);
+    }
+    displayio_tilegrid_set_scrolled(scroll.tilegrid);
+
+    size_t count = displayio_area_subtract(&scroll.tilegrid->current_area, &scroll.dest, exposed);
+    count += displayio_area_subtract(&scroll.tilegrid->previous_area, &scroll.tilegrid->current_area, exposed + count);
+    for (size_t i = 0; i < count; i++) {
+        exposed[i].next = i + 1 < count ? &exposed[i + 1] : NULL;
+    }
+    if (count > 0) {
+        *exposed_list = exposed;
+    }
+    return true;
+}
+
 static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
@@ -216,13 +263,19 @@ static void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
         return;
     }
     displayio_display_core_start_refresh(&self->core);
-    const displayio_area_t *current_area = _get_refresh_areas(self);
-    if (current_area) {
-        bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
-        int row_count = transposed ? self->core.width : self->core.height;
-        uint8_t dirty_row_bitmask[(row_count + 7) / 8];
-        memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
-        self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
+    bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
+    int row_count = transposed ? self->core.width : self->core.height;
+    uint8_t dirty_row_bitmask[(row_count + 7) / 8];
+    memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
+    self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
+    displayio_area_t exposed_areas[FRAMEBUFFERDISPLAY_SCROLL_AREAS];
+    displayio_area_t *exposed;
+    bool scrolled = _scroll(self, exposed_areas, &exposed, dirty_row_bitmask);
+    // Merge overlapping and nearby areas so that no pixel is rendered twice.
+    displayio_area_t merged_areas[CIRCUITPY_DISPLAY_MERGED_AREAS];
+    const displayio_area_t *current_area = displayio_display_core_merge_areas(&self->core, _get_refresh_areas(self, exposed),
+        merged_areas, CIRCUITPY_DISPLAY_MERGED_AREAS, FRAMEBUFFERDISPLAY_AREA_OVERHEAD);
+    if (current_area || scrolled) {
         while (current_area != NULL) {
             _refresh_area(self, current_area, dirty_row_bitmask);
             current_area = current_area->next;
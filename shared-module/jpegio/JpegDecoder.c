@@ -8,7 +8,9 @@
 
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-bindings/bitmaptools/__init__.h"
+#include "shared-bindings/displayio/Bitmap.h"
 #include "shared-module/jpegio/JpegDecoder.h"
+#include "shared-module/displayio/ColorConverter.h"
 
 typedef size_t (*input_func)(JDEC *jd, uint8_t *dest, size_t len);
 
@@ -125,23 +127,80 @@ mp_obj_t common_hal_jpegio_jpegdecoder_set_source_buffer(jpegio_jpegdecoder_obj_
 
 #define DECODER_CONTINUE (1)
 #define DECODER_INTERRUPT (0)
+
+// Converts rows of RGB888 pixels from the decoder straight into the destination bitmap's rows.
+// src holds src_width pixels per row; rows y1 to y2 - 1, columns x1 to x2 - 1 are written at dest_x, dest_y.
+static void write_rows(jpegio_jpegdecoder_obj_t *self, const uint8_t *src, int src_width,
+    int dest_x, int dest_y, int x1, int y1, int x2, int y2) {
+    displayio_bitmap_t *dest = self->dest;
+    bool gray = self->colorspace == DISPLAYIO_COLORSPACE_L8;
+    bool bgr = self->colorspace == DISPLAYIO_COLORSPACE_BGR565 || self->colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED;
+    bool swapped = self->colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED || self->colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED;
+    // Without chroma keys, and when the bitmap depth matches the colorspace, whole rows are stored directly.
+    bool direct = self->skip_source_index_none && self->skip_dest_index_none &&
+        dest->bits_per_value == (gray ? 8 : 16);
+    int r_index = bgr ? 2 : 0;
+    int b_index = bgr ? 0 : 2;
+
+    for (int sy = y1; sy < y2; sy++) {
+        const uint8_t *in = src + (sy * src_width + x1) * 3;
+        int dy = dest_y + sy - y1;
+        uint32_t *row = dest->data + dy * dest->stride;
+        if (direct && gray) {
+            uint8_t *out = (uint8_t *)row + dest_x;
+            for (int sx = x1; sx < x2; sx++, in += 3) {
+                *out++ = displayio_colorconverter_compute_luma(in[0] << 16 | in[1] << 8 | in[2]);
+            }
+        } else if (direct) {
+            uint16_t *out = (uint16_t *)row + dest_x;
+            for (int sx = x1; sx < x2; sx++, in += 3) {
+                uint16_t packed = (in[r_index] & 0xf8) << 8 | (in[1] & 0xfc) << 3 | in[b_index] >> 3;
+                *out++ = swapped ? __builtin_bswap16(packed) : packed;
+            }
+        } else {
+            for (int sx = x1; sx < x2; sx++, in += 3) {
+                uint32_t value;
+                if (gray) {
+                    value = displayio_colorconverter_compute_luma(in[0] << 16 | in[1] << 8 | in[2]);
+                } else {
+                    uint16_t packed = (in[r_index] & 0xf8) << 8 | (in[1] & 0xfc) << 3 | in[b_index] >> 3;
+                    value = swapped ? __builtin_bswap16(packed) : packed;
+                }
+                int dx = dest_x + sx - x1;
+                if (!self->skip_source_index_none && value == self->skip_source_index) {
+                    continue;
+                }
+                if (!self->skip_dest_index_none && common_hal_displayio_bitmap_get_pixel(dest, dx, dy) == self->skip_dest_index) {
+                    continue;
+                }
+                displayio_bitmap_write_pixel(dest, dx, dy, value);
+            }
+        }
+    }
+}
+
+// Hands the rows of the strip decoded so far to the strip callback.
+static void flush_strip(jpegio_jpegdecoder_obj_t *self, uint16_t end) {
+    if (end > self->strip_top) {
+        mp_call_function_2(self->strip_callback, MP_OBJ_NEW_SMALL_INT(self->strip_top), MP_OBJ_NEW_SMALL_INT(end - self->strip_top));
+    }
+    self->strip_top = end;
+}
+
 static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
-    int src_width = rect->right - rect->left + 1, src_pixel_stride = src_width /* in units of pixels! */, src_height = rect->bottom - rect->top + 1;
-
-    displayio_bitmap_t src = {
-        .width = src_width,
-        .height = src_height,
-        .data = data,
-        .stride = src_pixel_stride / 2, /* in units of uint32_t */
-        .bits_per_value = 16,
-        .x_shift = 1,
-        .x_mask = 1,
-        .bitmask = 0xffff,
-    };
+    int src_width = rect->right - rect->left + 1, src_height = rect->bottom - rect->top + 1;
+
+    if (self->strip_callback != MP_OBJ_NULL) {
+        // A new row of MCUs that does not fit below the rows already in the strip bitmap starts a new strip.
+        if (rect->bottom >= self->strip_top + self->dest->height) {
+            flush_strip(self, rect->top);
+        }
+        self->strip_end = MAX(self->strip_end, rect->bottom + 1);
+    }
 
     int x = self->x;
-    int y = self->y;
+    int y = self->y - self->strip_top;
     int x1 = self->lim.x1 - rect->left;
     int x2 = self->lim.x2 - rect->left;
     int y1 = self->lim.y1 - rect->top;
@@ -174,15 +233,44 @@ static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
         y1 = 0;
     }
 
-    // blit takes care of x, y out of range
-    assert(x1 >= 0);
-    assert(y1 >= 0);
-    // blit takes care of x1 >= x2 and y1 >= y2 cases
-    assert(x2 <= src_width);
-    assert(y2 <= src_height);
+    // Clip to the destination bitmap
+    x2 = MIN(x2, x1 + (self->dest->width - x));
+    y2 = MIN(y2, y1 + (self->dest->height - y));
+    if (x1 >= x2 || y1 >= y2) {
+        return DECODER_CONTINUE;
+    }
+
+    write_rows(self, data, src_width, x, y, x1, y1, x2, y2);
+
+    displayio_area_t area = { x, y, x + (x2 - x1), y + (y2 - y1), NULL };
+    displayio_bitmap_set_dirty_area(self->dest, &area);
+    return DECODER_CONTINUE;
+}
+
+static void decode_rect(jpegio_jpegdecoder_obj_t *self, displayio_bitmap_t *bitmap, int scale, displayio_colorspace_t colorspace) {
+    if (self->data_obj == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
+    }
+    if (bitmap->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+
+    self->dest = bitmap;
+    self->colorspace = colorspace;
 
-    common_hal_bitmaptools_blit(self->dest, &src, x, y, x1, y1, x2, y2, self->skip_source_index, self->skip_source_index_none, self->skip_dest_index, self->skip_dest_index_none);
-    return 1;
+    JRESULT result = JDR_OK;
+    if (self->lim.x1 < self->lim.x2 && self->lim.y1 < self->lim.y2) {
+        // Only MCUs covering the source rectangle are transformed and output.
+        JRECT roi = { self->lim.x1, self->lim.x2 - 1, self->lim.y1, self->lim.y2 - 1 };
+        result = jd_decomp_rect(&self->decoder, bitmap_output, scale, &roi);
+    }
+    if (self->strip_callback != MP_OBJ_NULL && result == JDR_OK) {
+        flush_strip(self, self->strip_end);
+    }
+    common_hal_jpegio_jpegdecoder_close(self);
+    if (result != JDR_INTR) {
+        check_jresult(result);
+    }
 }
 
 void common_hal_jpegio_jpegdecoder_decode_into(
@@ -190,23 +278,45 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
-    uint32_t skip_dest_index, bool skip_dest_index_none) {
-    if (self->data_obj == MP_OBJ_NULL) {
-        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
-    }
-
+    uint32_t skip_dest_index, bool skip_dest_index_none,
+    displayio_colorspace_t colorspace) {
     self->x = x;
     self->y = y;
     self->lim = *lim;
+    // Source pixels that would land outside the bitmap need not be decoded.
+    self->lim.x2 = MIN(self->lim.x2, self->lim.x1 + (bitmap->width - x));
+    self->lim.y2 = MIN(self->lim.y2, self->lim.y1 + (bitmap->height - y));
     self->skip_source_index = skip_source_index;
     self->skip_source_index_none = skip_source_index_none;
     self->skip_dest_index = skip_dest_index;
     self->skip_dest_index_none = skip_dest_index_none;
+    self->strip_callback = MP_OBJ_NULL;
+    self->strip_top = 0;
 
-    self->dest = bitmap;
-    JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
-    common_hal_jpegio_jpegdecoder_close(self);
-    if (result != JDR_INTR) {
-        check_jresult(result);
+    decode_rect(self, bitmap, scale, colorspace);
+}
+
+void common_hal_jpegio_jpegdecoder_decode_strips(
+    jpegio_jpegdecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, mp_obj_t callback, int scale,
+    displayio_colorspace_t colorspace) {
+    if (self->data_obj != MP_OBJ_NULL) {
+        // Each strip must be able to hold at least one row of MCUs.
+        mp_arg_validate_int_min(bitmap->height, MAX(1, (self->decoder.msy * 8) >> scale), MP_QSTR_bitmap);
     }
+
+    self->x = 0;
+    self->y = 0;
+    self->lim.x1 = 0;
+    self->lim.y1 = 0;
+    self->lim.x2 = MIN(bitmap->width, (self->decoder.width + (1 << scale) - 1) >> scale);
+    self->lim.y2 = INT16_MAX;
+    self->skip_source_index_none = true;
+    self->skip_dest_index_none = true;
+    self->strip_callback = callback;
+    self->strip_top = 0;
+    self->strip_end = 0;
+
+    decode_rect(self, bitmap, scale, colorspace);
+    self->strip_callback = MP_OBJ_NULL;
 }
@@ -8,6 +8,7 @@
 
 #include "py/obj.h"
 #include "lib/tjpgd/src/tjpgd.h"
+#include "shared-bindings/displayio/__init__.h"
 #include "shared-module/displayio/Bitmap.h"
 
 #define TJPGD_WORKSPACE_SIZE 3500
@@ -24,4 +25,8 @@ typedef struct jpegio_jpegdecoder_obj {
     uint32_t skip_source_index, skip_dest_index;
     bool skip_source_index_none, skip_dest_index_none;
     uint8_t scale;
+    displayio_colorspace_t colorspace;
+    // When set, dest holds one strip of rows starting at image row strip_top.
+    mp_obj_t strip_callback;
+    uint16_t strip_top, strip_end;
 } jpegio_jpegdecoder_obj_t;
@@ -12,6 +12,7 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-module/struct/__init__.h"
 
 static void struct_validate_format(char fmt) {
     #if MICROPY_NONSTANDARD_TYPECODES
@@ -195,5 +196,121 @@ mp_obj_tuple_t *shared_modules_struct_unpack_from(mp_obj_t fmt_in, byte *p, byte
         fmt++;
     }
     return res;
+}
+
+struct_struct_obj_t *shared_modules_struct_struct_compile(const mp_obj_type_t *type, mp_obj_t fmt_in) {
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type = get_fmt_type(&fmt);
+
+    // Each non-digit character is one field; repeat counts are folded into it.
+    size_t num_fields = 0;
+    for (const char *f = fmt; *f; f++) {
+        if (!unichar_isdigit(*f)) {
+            num_fields++;
+        }
+    }
+
+    struct_struct_obj_t *st = mp_obj_malloc_var(struct_struct_obj_t, fields, struct_field_t, num_fields, type);
+    st->format = fmt_in;
+    st->fmt_type = fmt_type;
+
+    mp_uint_t size = 0;
+    mp_uint_t num_items = 0;
+    size_t i = 0;
+    for (; *fmt; fmt++) {
+        struct_validate_format(*fmt);
+
+        mp_uint_t cnt = 1;
+        if (unichar_isdigit(*fmt)) {
+            cnt = get_fmt_num(&fmt);
+        }
+
+        if (*fmt == 's') {
+            size += cnt;
+            num_items++;
+        } else {
+            mp_uint_t align;
+            size_t sz = mp_binary_get_size(fmt_type, *fmt, &align);
+            if (cnt > 0) {
+                // Only the first of a run needs aligning; sz is a multiple of align.
+                size = (size + align - 1) & ~(align - 1);
+                size += sz * cnt;
+            }
+            // Pad bytes are skipped and don't get included in the item count.
+            if (*fmt != 'x') {
+                num_items += cnt;
+            }
+        }
+        st->fields[i].type = *fmt;
+        st->fields[i].count = cnt;
+        i++;
+    }
+    st->num_fields = i;
+    st->size = size;
+    st->num_items = num_items;
+    return st;
+}
 
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *st, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args) {
+    if (p + st->size > end_p) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+    }
+    (void)mp_arg_validate_length(n_args, st->num_items, MP_QSTR_values);
+
+    byte *p_base = p;
+    for (size_t i = 0; i < st->num_fields; i++) {
+        const struct_field_t *field = &st->fields[i];
+        mp_uint_t cnt = field->count;
+        if (field->type == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(*args++, &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(cnt, bufinfo.len);
+            memcpy(p, bufinfo.buf, to_copy);
+            memset(p + to_copy, 0, cnt - to_copy);
+            p += cnt;
+        } else if (field->type == 'x') {
+            // Pad bytes don't have a corresponding argument.
+            memset(p, 0, cnt);
+            p += cnt;
+        } else {
+            while (cnt--) {
+                mp_binary_set_val(st->fmt_type, field->type, *args++, p_base, &p);
+            }
+        }
+    }
+}
+
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *st, byte *p, byte *end_p, bool exact_size, mp_obj_t *items) {
+    if (exact_size) {
+        if (p + st->size != end_p) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("buffer size must match format"));
+        }
+    } else {
+        if (p + st->size > end_p) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("buffer too small"));
+        }
+    }
+
+    byte *p_base = p;
+    for (size_t i = 0; i < st->num_fields; i++) {
+        const struct_field_t *field = &st->fields[i];
+        mp_uint_t cnt = field->count;
+        if (field->type == 's') {
+            *items++ = mp_obj_new_bytes(p, cnt);
+            p += cnt;
+        } else if (field->type == 'x') {
+            // Pad bytes are not stored.
+            p += cnt;
+        } else {
+            while (cnt--) {
+                *items++ = mp_binary_get_val(st->fmt_type, field->type, p_base, &p);
+            }
+        }
+    }
+}
+
+mp_obj_tuple_t *shared_modules_struct_struct_unpack_from(struct_struct_obj_t *st, byte *p, byte *end_p, bool exact_size) {
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(st->num_items, NULL));
+    shared_modules_struct_struct_unpack_into(st, p, end_p, exact_size, res->items);
+    return res;
 }
@@ -5,6 +5,28 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
-char get_fmt_type(const char **fmt);
-mp_uint_t get_fmt_num(const char **p);
-mp_uint_t calcsize_items(const char *fmt);
+#include "py/obj.h"
+
+// One parsed format code: the type character and its repeat count.
+typedef struct {
+    char type;
+    mp_uint_t count;
+} struct_field_t;
+
+// A format string parsed once, so packing and unpacking don't re-read it.
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t format;
+    mp_uint_t size;
+    mp_uint_t num_items;
+    size_t num_fields;
+    char fmt_type;
+    struct_field_t fields[];
+} struct_struct_obj_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    struct_struct_obj_t *st;
+    mp_obj_t buffer;
+    size_t offset;
+} struct_unpack_iter_obj_t;
@@ -44,6 +44,26 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+// Covers the same pixels as get_pixel: |x| <= floor(sqrt(radius^2 - y^2)).
+uint16_t common_hal_vectorio_circle_get_spans(void *obj, int16_t y, const int16_t **spans) {
+    vectorio_circle_t *self = obj;
+    *spans = self->span;
+    int32_t radius = self->radius;
+    int32_t ay = abs(y);
+    if (ay > radius) {
+        return 0;
+    }
+    int32_t remaining = radius * radius - ay * ay;
+    // Integer square root by Newton's method, starting from above the root.
+    int32_t half_width = radius;
+    while (half_width > 0 && half_width * half_width > remaining) {
+        half_width = (half_width + remaining / half_width) / 2;
+    }
+    self->span[0] = -half_width;
+    self->span[1] = half_width + 1;
+    return 1;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
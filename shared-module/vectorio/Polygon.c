@@ -19,6 +19,42 @@
 // #define VECTORIO_POLYGON_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
 
+// Builds the table of non-horizontal edges, sorted by their top y, that get_spans walks.
+static void _build_edge_table(vectorio_polygon_t *self) {
+    uint16_t point_count = self->len / 2;
+    vectorio_polygon_edge_t *edges = gc_realloc(self->edges, point_count * sizeof(vectorio_polygon_edge_t), true);
+    self->edges = edges;
+    self->crossings = gc_realloc(self->crossings, point_count * sizeof(vectorio_polygon_crossing_t), true);
+    self->spans = gc_realloc(self->spans, point_count * sizeof(int16_t), true);
+
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < point_count; ++i) {
+        int16_t x1 = self->points_list[2 * i];
+        int16_t y1 = self->points_list[2 * i + 1];
+        int16_t x2 = self->points_list[(2 * i + 2) % self->len];
+        int16_t y2 = self->points_list[(2 * i + 3) % self->len];
+        if (y1 == y2) {
+            // Horizontal edges never change the winding number.
+            continue;
+        }
+        vectorio_polygon_edge_t edge;
+        if (y1 < y2) {
+            edge = (vectorio_polygon_edge_t) { .y_top = y1, .y_bottom = y2, .x_top = x1, .x_bottom = x2, .winding = 1 };
+        } else {
+            edge = (vectorio_polygon_edge_t) { .y_top = y2, .y_bottom = y1, .x_top = x2, .x_bottom = x1, .winding = -1 };
+        }
+        // Insertion sort; polygons are small and this only runs when the points change.
+        uint16_t j = count;
+        while (j > 0 && edges[j - 1].y_top > edge.y_top) {
+            edges[j] = edges[j - 1];
+            --j;
+        }
+        edges[j] = edge;
+        ++count;
+    }
+    self->edge_count = count;
+}
+
 // Converts a list of points tuples to a flat list of ints for speedier internal use.
 // Also validates the points. If this fails due to invalid types or values, the
 // number of points is 0 and the points_list is NULL.
@@ -57,6 +93,8 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 
     self->points_list = points_list;
     self->len = 2 * len;
+
+    _build_edge_table(self);
 }
 
 
@@ -65,6 +103,10 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->edges = NULL;
+    self->edge_count = 0;
+    self->crossings = NULL;
+    self->spans = NULL;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -185,6 +227,66 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Computes the same coverage as get_pixel for a whole row. A pixel is counted by an edge
+// crossing row y when it is strictly left of the edge, that is when x < ceil(crossing x),
+// so the winding number only changes at those integer columns.
+uint16_t common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, const int16_t **spans) {
+    vectorio_polygon_t *self = obj;
+    *spans = self->spans;
+    if (self->len == 0) {
+        return 0;
+    }
+
+    vectorio_polygon_crossing_t *crossings = self->crossings;
+    uint16_t crossing_count = 0;
+    for (uint16_t i = 0; i < self->edge_count; ++i) {
+        const vectorio_polygon_edge_t *edge = &self->edges[i];
+        if (edge->y_top > y) {
+            // Sorted by y_top, so no later edge reaches this row either.
+            break;
+        }
+        if (y >= edge->y_bottom) {
+            continue;
+        }
+        int32_t num = (int32_t)(y - edge->y_top) * (edge->x_bottom - edge->x_top);
+        int32_t den = edge->y_bottom - edge->y_top;
+        int32_t q = num / den;
+        if (num % den > 0) {
+            ++q;
+        }
+        vectorio_polygon_crossing_t crossing = { .x = edge->x_top + q, .winding = edge->winding };
+        uint16_t j = crossing_count;
+        while (j > 0 && crossings[j - 1].x > crossing.x) {
+            crossings[j] = crossings[j - 1];
+            --j;
+        }
+        crossings[j] = crossing;
+        ++crossing_count;
+    }
+
+    uint16_t span_count = 0;
+    int16_t winding_number = 0;
+    for (uint16_t i = 0; i < crossing_count;) {
+        int16_t x = crossings[i].x;
+        while (i < crossing_count && crossings[i].x == x) {
+            winding_number -= crossings[i].winding;
+            ++i;
+        }
+        if (winding_number == 0 || i == crossing_count) {
+            continue;
+        }
+        if (span_count > 0 && self->spans[2 * span_count - 1] == x) {
+            // Extend the previous span rather than starting an adjacent one.
+            self->spans[2 * span_count - 1] = crossings[i].x;
+        } else {
+            self->spans[2 * span_count] = x;
+            self->spans[2 * span_count + 1] = crossings[i].x;
+            ++span_count;
+        }
+    }
+    return span_count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
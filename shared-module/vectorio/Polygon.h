@@ -11,12 +11,32 @@
 #include "py/obj.h"
 #include "shared-module/vectorio/__init__.h"
 
+// A non-horizontal polygon edge, stored top to bottom.
+typedef struct {
+    int16_t y_top;
+    int16_t y_bottom;
+    int16_t x_top;
+    int16_t x_bottom;
+    int8_t winding; // +1 if the edge runs downwards in the points list, else -1
+} vectorio_polygon_edge_t;
+
+typedef struct {
+    int16_t x;
+    int8_t winding;
+} vectorio_polygon_crossing_t;
+
 typedef struct {
     mp_obj_base_t base;
     // An int array[ x, y, ... ]
     int16_t *points_list;
     uint16_t len;
     uint16_t color_index;
+    // Edge table sorted by y_top, rebuilt whenever the points change.
+    vectorio_polygon_edge_t *edges;
+    uint16_t edge_count;
+    // Scratch space for get_spans, edge_count entries each.
+    vectorio_polygon_crossing_t *crossings;
+    int16_t *spans;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
 } vectorio_polygon_t;
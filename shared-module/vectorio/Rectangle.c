@@ -33,6 +33,17 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+uint16_t common_hal_vectorio_rectangle_get_spans(void *obj, int16_t y, const int16_t **spans) {
+    vectorio_rectangle_t *self = obj;
+    *spans = self->span;
+    if (y < 0 || y >= self->height || self->width == 0) {
+        return 0;
+    }
+    self->span[0] = 0;
+    self->span[1] = self->width;
+    return 1;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -16,6 +16,7 @@ typedef struct {
     uint16_t width;
     uint16_t height;
     uint16_t color_index;
+    int16_t span[2]; // Returned by get_spans
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
 } vectorio_rectangle_t;
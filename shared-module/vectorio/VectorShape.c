@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "stdlib.h"
+#include <string.h>
 
 #include "shared-module/vectorio/__init__.h"
 #include "shared-bindings/vectorio/VectorShape.h"
@@ -14,6 +15,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/displayio/Palette.h"
+#include "shared-module/displayio/ColorConverter.h"
 
 #include "shared-bindings/vectorio/Circle.h"
 #include "shared-bindings/vectorio/Polygon.h"
@@ -326,6 +328,244 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Writes an output pixel value into the buffer in the colorspace's packing.
+static void _store_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint16_t pixel_index, uint16_t linestride_px, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", pixel);
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", pixel);
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", pixel);
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+// Runs the pixel shader on a shape pixel value, which must not be 0.
+static void _shade_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+
+    // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
+    input_pixel->pixel -= 1;
+    output_pixel->opaque = true;
+
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+}
+
+// Returns true if the shader gives the same output for a value wherever it is on screen.
+static bool _shader_is_position_independent(vectorio_vector_shape_t *self) {
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        return !((displayio_palette_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither;
+    }
+    if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return !((displayio_colorconverter_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither;
+    }
+    return true;
+}
+
+// Shades a pixel covered by the shape and writes it into the buffer, marking it in the mask.
+// input_pixel->pixel is the shape's pixel value, which must not be 0.
+static void _write_covered_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel,
+    uint16_t pixel_index, uint16_t linestride_px, uint32_t *mask, uint32_t *buffer, bool *full_coverage) {
+    displayio_output_pixel_t output_pixel;
+    _shade_pixel(self, colorspace, input_pixel, &output_pixel);
+
+    // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
+    if (!output_pixel.opaque) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+        *full_coverage = false;
+    }
+
+    mask[pixel_index / 32] |= 1u << (pixel_index % 32);
+    _store_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
+}
+
+static inline bool _is_masked(const uint32_t *mask, uint16_t pixel_index) {
+    return (mask[pixel_index / 32] & (1u << (pixel_index % 32))) != 0;
+}
+
+// Returns true if any pixel in [start, end) of the buffer is not yet masked.
+static bool _any_unmasked(const uint32_t *mask, uint16_t start, uint16_t end) {
+    for (uint16_t i = start; i < end; i++) {
+        if (!_is_masked(mask, i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Writes one already shaded pixel value to every unmasked pixel in [start, end) of the buffer
+// and masks them. Returns how many pixels were written.
+static uint16_t _fill_run(const _displayio_colorspace_t *colorspace, uint32_t *mask, uint32_t *buffer,
+    uint16_t start, uint16_t end, uint16_t linestride_px, uint32_t pixel) {
+    uint16_t written = 0;
+    uint16_t i = start;
+    while (i < end) {
+        uint32_t *mask_doubleword = &mask[i / 32];
+        if (i % 32 == 0 && end - i >= 32 && *mask_doubleword == 0) {
+            // No pixel of this mask word is set yet, so fill all 32 without checking each.
+            *mask_doubleword = 0xffffffff;
+            if (colorspace->depth == 16) {
+                uint16_t *p = ((uint16_t *)buffer) + i;
+                for (uint8_t k = 0; k < 32; k++) {
+                    p[k] = pixel;
+                }
+            } else if (colorspace->depth == 32) {
+                uint32_t *p = buffer + i;
+                for (uint8_t k = 0; k < 32; k++) {
+                    p[k] = pixel;
+                }
+            } else if (colorspace->depth == 8) {
+                memset(((uint8_t *)buffer) + i, pixel, 32);
+            } else {
+                for (uint8_t k = 0; k < 32; k++) {
+                    _store_pixel(colorspace, buffer, i + k, linestride_px, pixel);
+                }
+            }
+            i += 32;
+            written += 32;
+            continue;
+        }
+        uint32_t bit = 1u << (i % 32);
+        if ((*mask_doubleword & bit) == 0) {
+            *mask_doubleword |= bit;
+            _store_pixel(colorspace, buffer, i, linestride_px, pixel);
+            written++;
+        }
+        i++;
+    }
+    return written;
+}
+
+// Fills the overlap a row at a time from the spans the shape covers, so the shape is asked
+// about each row once instead of about each pixel. Returns false if an unmasked pixel of the
+// overlap was left uncovered.
+static bool _fill_area_spans(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
+    const displayio_area_t *overlap, uint32_t *mask, uint32_t *buffer) {
+    bool full_coverage = true;
+    uint16_t linestride_px = displayio_area_width(area);
+
+    // Screen x is shape x + x_offset, or x_offset - 1 - shape x when mirrored.
+    bool mirror_x = self->absolute_transform->dx < 1;
+    int32_t x_offset = self->absolute_transform->x + self->absolute_transform->dx * self->x;
+
+    // Without dithering every pixel of a span shades to the same colour, so convert it once
+    // and fill whole runs with it.
+    bool fill_runs = _shader_is_position_independent(self);
+    uint32_t shaded_value = 0;
+    displayio_output_pixel_t shaded_pixel;
+
+    // Dithering shaders read the position in the shape from tile_x and tile_y, as for a
+    // TileGrid's position in its bitmap.
+    displayio_input_pixel_t input_pixel;
+    input_pixel.tile = 0;
+    for (input_pixel.y = overlap->y1; input_pixel.y < overlap->y2; ++input_pixel.y) {
+        uint16_t row_start_px = (input_pixel.y - area->y1) * linestride_px + (overlap->x1 - area->x1);
+        int16_t shape_x;
+        int16_t shape_y;
+        screen_to_shape_coordinates(self, overlap->x1, input_pixel.y, &shape_x, &shape_y);
+        input_pixel.tile_y = shape_y;
+
+        const int16_t *spans;
+        uint16_t span_count = self->ishape.get_spans(self->ishape.shape, shape_y, &spans);
+        uint32_t value = 0;
+        if (span_count > 0) {
+            value = self->ishape.get_pixel(self->ishape.shape, spans[0], shape_y);
+        }
+
+        // Screen column up to which the row has been filled or checked for coverage.
+        int32_t done_x = overlap->x1;
+        for (uint16_t i = 0; i < span_count && value != 0; ++i) {
+            int32_t x1;
+            int32_t x2;
+            if (mirror_x) {
+                // Spans are in increasing shape x, so walk them from the end.
+                const int16_t *span = &spans[2 * (span_count - 1 - i)];
+                x1 = x_offset - span[1];
+                x2 = x_offset - span[0];
+            } else {
+                x1 = spans[2 * i] + x_offset;
+                x2 = spans[2 * i + 1] + x_offset;
+            }
+            x1 = MAX(x1, overlap->x1);
+            x2 = MIN(x2, overlap->x2);
+            if (x1 >= x2) {
+                continue;
+            }
+            if (full_coverage && x1 > done_x && _any_unmasked(mask, row_start_px + (done_x - overlap->x1), row_start_px + (x1 - overlap->x1))) {
+                full_coverage = false;
+            }
+            if (fill_runs) {
+                if (shaded_value != value) {
+                    input_pixel.x = x1;
+                    input_pixel.tile_x = mirror_x ? x_offset - 1 - x1 : x1 - x_offset;
+                    input_pixel.pixel = value;
+                    _shade_pixel(self, colorspace, &input_pixel, &shaded_pixel);
+                    shaded_value = value;
+                }
+                uint16_t written = _fill_run(colorspace, mask, buffer,
+                    row_start_px + (x1 - overlap->x1), row_start_px + (x2 - overlap->x1), linestride_px, shaded_pixel.pixel);
+                if (written > 0 && !shaded_pixel.opaque) {
+                    full_coverage = false;
+                }
+            } else {
+                for (input_pixel.x = x1; input_pixel.x < x2; ++input_pixel.x) {
+                    uint16_t pixel_index = row_start_px + (input_pixel.x - overlap->x1);
+                    if (_is_masked(mask, pixel_index)) {
+                        continue;
+                    }
+                    input_pixel.tile_x = mirror_x ? x_offset - 1 - input_pixel.x : input_pixel.x - x_offset;
+                    input_pixel.pixel = value;
+                    _write_covered_pixel(self, colorspace, &input_pixel, pixel_index, linestride_px, mask, buffer, &full_coverage);
+                }
+            }
+            done_x = x2;
+        }
+        if (full_coverage && done_x < overlap->x2 && _any_unmasked(mask, row_start_px + (done_x - overlap->x1), row_start_px + (overlap->x2 - overlap->x1))) {
+            full_coverage = false;
+        }
+    }
+    return full_coverage;
+}
+
+#ifdef VECTORIO_PERF
+// pixel_time is the time spent in get_pixel, which is 0 when filling from spans.
+static void _report_fill_perf(vectorio_vector_shape_t *self, const displayio_area_t *overlap, uint64_t start, uint64_t pixel_time) {
+    uint64_t end = common_hal_time_monotonic_ns();
+    uint32_t pixels = (overlap->x2 - overlap->x1) * (overlap->y2 - overlap->y1);
+    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_pixels:{%6.1fus total, %4.1fus/px}\n",
+        mp_obj_get_type_str(self->ishape.shape),
+        pixels,
+        (double)((end - start) / 1000000.0),
+        (double)(MAX(1, pixels * (1000000000.0 / (end - start)))),
+        (double)(pixel_time / 1000.0),
+        (double)(pixel_time / 1000.0 / pixels)
+        );
+}
+#endif
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -354,7 +594,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -365,13 +604,22 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
     VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, 8 / colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
 
-    displayio_input_pixel_t input_pixel;
-    displayio_output_pixel_t output_pixel;
+    // Rows of the screen are rows of the shape unless the transform swaps x and y.
+    if (self->ishape.get_spans != NULL && !self->absolute_transform->transpose_xy) {
+        if (!_fill_area_spans(self, colorspace, area, &overlap, mask, buffer)) {
+            full_coverage = false;
+        }
+        #ifdef VECTORIO_PERF
+        _report_fill_perf(self, &overlap, start, pixel_time);
+        #endif
+        VECTORIO_SHAPE_DEBUG(" -> spans\n");
+        return full_coverage;
+    }
 
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
+    displayio_input_pixel_t input_pixel;
+    input_pixel.tile = 0;
 
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
@@ -379,14 +627,11 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
-            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
-            uint8_t mask_bit = pixel_index % 32;
-            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
-            if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, pixel_index % 32, U32_TO_BINARY(mask[pixel_index / 32]));
+            if (_is_masked(mask, pixel_index)) {
                 VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
                 continue;
             }
-            output_pixel.pixel = 0;
 
             // Cast input screen coordinates to shape coordinates to pick the pixel to draw
             int16_t pixel_to_get_x;
@@ -398,6 +643,8 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             uint64_t pre_pixel = common_hal_time_monotonic_ns();
             #endif
             input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            input_pixel.tile_x = pixel_to_get_x;
+            input_pixel.tile_y = pixel_to_get_y;
             #ifdef VECTORIO_PERF
             uint64_t post_pixel = common_hal_time_monotonic_ns();
             pixel_time += post_pixel - pre_pixel;
@@ -410,64 +657,13 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
                 full_coverage = false;
             } else {
-                // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
-                input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                }
-
-                // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
-                    full_coverage = false;
-                }
-
-                *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _write_covered_pixel(self, colorspace, &input_pixel, pixel_index, linestride_px, mask, buffer, &full_coverage);
             }
         }
         mask_start_px += linestride_px - column_dirty_offset_px;
     }
     #ifdef VECTORIO_PERF
-    uint64_t end = common_hal_time_monotonic_ns();
-    uint32_t pixels = (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1);
-    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_pixels:{%6.1fus total, %4.1fus/px}\n",
-        mp_obj_get_type_str(self->ishape.shape),
-        (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1),
-        (double)((end - start) / 1000000.0),
-        (double)(MAX(1, pixels * (1000000000.0 / (end - start)))),
-        (double)(pixel_time / 1000.0),
-        (double)(pixel_time / 1000.0 / pixels)
-        );
+    _report_fill_perf(self, &overlap, start, pixel_time);
     #endif
     VECTORIO_SHAPE_DEBUG(" -> pixels:%4d\n", (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1));
     return full_coverage;
@@ -16,6 +16,10 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Returns the number of [x1, x2) ranges of row y that are covered by the shape and points
+// *spans at them as x1, x2 pairs in increasing order. They are in shape coordinates and stay
+// valid until the next call. Every pixel of a span has the same get_pixel value.
+typedef uint16_t get_spans_function(mp_obj_t shape, int16_t y, const int16_t **spans);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +31,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans; // Optional, NULL if only get_pixel is available.
 } vectorio_ishape_t;
 
 typedef struct {
@@ -41,6 +41,15 @@ static uint32_t dirty_mask;
 #define FLASH_CACHE_TABLE_SIZE (FLASH_CACHE_TABLE_NUM_ENTRIES * sizeof (uint8_t *))
 static uint8_t **flash_cache_table = NULL;
 
+#if SPI_FLASH_READAHEAD_BLOCKS > 0
+// Blocks read ahead of a sequential reader. readahead_count is 0 when the buffer holds nothing.
+static uint8_t *readahead_buffer = NULL;
+static uint32_t readahead_first_block;
+static uint32_t readahead_count;
+#endif
+// Block following the last one read, used to detect sequential reads.
+static uint32_t next_sequential_block;
+
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
     if (flash_device == NULL) {
@@ -135,7 +144,7 @@ static bool page_erased(uint32_t sector_address) {
     uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
     if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
         for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+            if (full_buffer[i] != 0xff) {
                 return false;
             }
         }
@@ -280,6 +289,11 @@ void supervisor_flash_init(void) {
     current_sector = NO_SECTOR_LOADED;
     dirty_mask = 0;
     flash_cache_table = NULL;
+    #if SPI_FLASH_READAHEAD_BLOCKS > 0
+    readahead_buffer = NULL;
+    readahead_count = 0;
+    #endif
+    next_sequential_block = 0;
 }
 
 // The size of each individual block.
@@ -446,6 +460,10 @@ static void spi_flash_flush_keep_cache(bool keep_cache) {
         flush_ram_cache(keep_cache);
     }
     current_sector = NO_SECTOR_LOADED;
+    #if SPI_FLASH_READAHEAD_BLOCKS > 0
+    // Read-ahead may have been filled while newer data was still in the cache.
+    readahead_count = 0;
+    #endif
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
@@ -457,6 +475,13 @@ void supervisor_external_flash_flush(void) {
 
 void supervisor_flash_release_cache(void) {
     spi_flash_flush_keep_cache(false);
+    #if SPI_FLASH_READAHEAD_BLOCKS > 0
+    if (readahead_buffer != NULL) {
+        port_free(readahead_buffer);
+        readahead_buffer = NULL;
+    }
+    readahead_count = 0;
+    #endif
 }
 
 static int32_t convert_block_to_flash_addr(uint32_t block) {
@@ -468,32 +493,99 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
-static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
-    int32_t address = convert_block_to_flash_addr(block);
-    if (address == -1) {
-        // bad block number
-        return false;
-    }
-
+// Returns true if the block currently lives in the write cache rather than in flash.
+static bool block_is_cached(uint32_t address) {
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
-    uint32_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
-        if (flash_cache_table != NULL) {
-            for (int i = 0; i < PAGES_PER_BLOCK; i++) {
-                memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * PAGES_PER_BLOCK + i],
-                    SPI_FLASH_PAGE_SIZE);
+    return current_sector == this_sector && (dirty_mask & (1 << block_index)) != 0;
+}
+
+static bool external_flash_read_cached_block(uint8_t *dest, uint32_t address) {
+    size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+    if (flash_cache_table != NULL) {
+        for (int i = 0; i < PAGES_PER_BLOCK; i++) {
+            memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
+                flash_cache_table[block_index * PAGES_PER_BLOCK + i],
+                SPI_FLASH_PAGE_SIZE);
+        }
+        return true;
+    } else {
+        uint32_t scratch_address = flash_device->total_size - SPI_FLASH_ERASE_SIZE + block_index * FILESYSTEM_BLOCK_SIZE;
+        return read_flash(scratch_address, dest, FILESYSTEM_BLOCK_SIZE);
+    }
+}
+
+#if SPI_FLASH_READAHEAD_BLOCKS > 0
+static void invalidate_readahead(uint32_t block, uint32_t num_blocks) {
+    if (readahead_count > 0 &&
+        block < readahead_first_block + readahead_count &&
+        readahead_first_block < block + num_blocks) {
+        readahead_count = 0;
+    }
+}
+
+// Serve a single block from the read-ahead buffer, refilling it if the block is part of a
+// sequential read. Returns false if the block should be read directly instead.
+static bool external_flash_readahead_block(uint8_t *dest, uint32_t block) {
+    if (readahead_count == 0 || block < readahead_first_block || block >= readahead_first_block + readahead_count) {
+        if (block != next_sequential_block) {
+            return false;
+        }
+        if (readahead_buffer == NULL) {
+            readahead_buffer = port_malloc(SPI_FLASH_READAHEAD_BLOCKS * FILESYSTEM_BLOCK_SIZE, false);
+            if (readahead_buffer == NULL) {
+                return false;
             }
-            return true;
-        } else {
-            uint32_t scratch_address = flash_device->total_size - SPI_FLASH_ERASE_SIZE + block_index * FILESYSTEM_BLOCK_SIZE;
-            return read_flash(scratch_address, dest, FILESYSTEM_BLOCK_SIZE);
         }
+        uint32_t count = MIN(SPI_FLASH_READAHEAD_BLOCKS, supervisor_flash_get_block_count() - block);
+        readahead_count = 0;
+        if (!read_flash(block * FILESYSTEM_BLOCK_SIZE, readahead_buffer, count * FILESYSTEM_BLOCK_SIZE)) {
+            return false;
+        }
+        readahead_first_block = block;
+        readahead_count = count;
+    }
+    memcpy(dest, readahead_buffer + (block - readahead_first_block) * FILESYSTEM_BLOCK_SIZE, FILESYSTEM_BLOCK_SIZE);
+    return true;
+}
+#endif
+
+mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > supervisor_flash_get_block_count() || block_num + num_blocks < block_num) {
+        return 1; // error
+    }
+    uint32_t end_block = block_num + num_blocks;
+    uint32_t block = block_num;
+    while (block < end_block) {
+        uint32_t address = block * FILESYSTEM_BLOCK_SIZE;
+        if (block_is_cached(address)) {
+            if (!external_flash_read_cached_block(dest, address)) {
+                return 1; // error
+            }
+            dest += FILESYSTEM_BLOCK_SIZE;
+            block++;
+            continue;
+        }
+        #if SPI_FLASH_READAHEAD_BLOCKS > 0
+        if (num_blocks == 1 && external_flash_readahead_block(dest, block)) {
+            break;
+        }
+        #endif
+        // Read the longest run of blocks that aren't in the write cache with one command.
+        uint32_t run = 1;
+        while (block + run < end_block && run < SPI_FLASH_MAX_READ_BLOCKS &&
+               !block_is_cached((block + run) * FILESYSTEM_BLOCK_SIZE)) {
+            run++;
+        }
+        if (!read_flash(address, dest, run * FILESYSTEM_BLOCK_SIZE)) {
+            return 1; // error
+        }
+        dest += run * FILESYSTEM_BLOCK_SIZE;
+        block += run;
     }
-    return read_flash(address, dest, FILESYSTEM_BLOCK_SIZE);
+    next_sequential_block = end_block;
+    return 0; // success
 }
 
 static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
@@ -542,20 +634,45 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
-mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
-            return 1; // error
-        }
+// Write a whole erase sector at once. Nothing in it needs to be preserved, so there is no
+// need to go through the cache and read the old contents back before erasing.
+static bool external_flash_write_sector(const uint8_t *data, uint32_t block) {
+    int32_t address = convert_block_to_flash_addr(block);
+    if (address == -1) {
+        // bad block number
+        return false;
     }
-    return 0; // success
+    wait_for_flash_ready();
+    if (current_sector == (uint32_t)address) {
+        // Every cached block is about to be replaced.
+        current_sector = NO_SECTOR_LOADED;
+        dirty_mask = 0;
+    }
+    if (!erase_sector(address)) {
+        return false;
+    }
+    return write_flash(address, data, SPI_FLASH_ERASE_SIZE);
 }
 
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    #if SPI_FLASH_READAHEAD_BLOCKS > 0
+    invalidate_readahead(block_num, num_blocks);
+    #endif
+    size_t i = 0;
+    while (i < num_blocks) {
+        uint32_t block = block_num + i;
+        if (flash_device != NULL && !flash_device->no_erase_cmd &&
+            (block % BLOCKS_PER_SECTOR) == 0 && num_blocks - i >= BLOCKS_PER_SECTOR) {
+            if (!external_flash_write_sector(src + i * FILESYSTEM_BLOCK_SIZE, block)) {
+                return 1; // error
+            }
+            i += BLOCKS_PER_SECTOR;
+            continue;
+        }
+        if (!external_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block)) {
             return 1; // error
         }
+        i++;
     }
     return 0; // success
 }
@@ -24,6 +24,17 @@
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #endif
 
+// Number of blocks fetched at once when blocks are read sequentially. The buffer is
+// allocated on first use and released with the write cache. 0 disables read-ahead.
+#ifndef SPI_FLASH_READAHEAD_BLOCKS
+#define SPI_FLASH_READAHEAD_BLOCKS (4)
+#endif
+
+// Longest run of contiguous blocks read with a single read command.
+#ifndef SPI_FLASH_MAX_READ_BLOCKS
+#define SPI_FLASH_MAX_READ_BLOCKS (64)
+#endif
+
 void supervisor_external_flash_flush(void);
 
 // Configure anything that needs to get set up before the external flash
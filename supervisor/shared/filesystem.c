@@ -27,13 +27,31 @@ static mp_vfs_mount_t _saves_vfs;
 static fs_user_mount_t _saves_usermount;
 #endif
 
+// Only the flash filesystems have a FatFs block cache, because they are flushed
+// periodically and before reset. Other mounts write straight through.
+#if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+static fs_block_cache_t _circuitpy_block_cache;
+#if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+static fs_block_cache_t _saves_block_cache;
+#endif
+#endif
+
 static volatile uint32_t filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
 volatile bool filesystem_flush_requested = false;
 
+// Write sectors held by the FatFs block cache out to flash.
+static void filesystem_flush_block_caches(void) {
+    fat_vfs_block_cache_flush(&_circuitpy_usermount);
+    #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+    fat_vfs_block_cache_flush(&_saves_usermount);
+    #endif
+}
+
 void filesystem_background(void) {
     if (filesystem_flush_requested) {
         filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
         // Flush but keep caches
+        filesystem_flush_block_caches();
         supervisor_flash_flush();
         filesystem_flush_requested = false;
     }
@@ -85,6 +103,9 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     fs_user_mount_t *circuitpy = &_circuitpy_usermount;
     circuitpy->blockdev.flags = 0;
     supervisor_flash_init_vfs(circuitpy);
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    circuitpy->block_cache = &_circuitpy_block_cache;
+    #endif
 
     #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
     // SAVES is placed before CIRCUITPY so that CIRCUITPY takes up the remaining space.
@@ -96,6 +117,9 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     saves->blockdev.offset = 0;
     saves->blockdev.size = CIRCUITPY_SAVES_PARTITION_SIZE;
     supervisor_flash_init_vfs(saves);
+    #if MICROPY_FATFS_BLOCK_CACHE_SECTORS > 0
+    saves->block_cache = &_saves_block_cache;
+    #endif
     filesystem_set_concurrent_write_protection(saves, true);
     filesystem_set_writable_by_usb(saves, false);
     #endif
@@ -228,6 +252,7 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 void PLACE_IN_ITCM(filesystem_flush)(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    filesystem_flush_block_caches();
     supervisor_flash_flush();
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
@@ -304,7 +304,11 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 // Callback invoked when WRITE10 command is completed (status received and accepted by host).
 // used to flush any pending cache.
 void tud_msc_write10_complete_cb(uint8_t lun) {
-    (void)lun;
+    // The host considers the data written, so don't leave it in the block cache.
+    fs_user_mount_t *vfs = get_vfs(lun);
+    if (vfs != NULL) {
+        fat_vfs_block_cache_flush(vfs);
+    }
 
     // This write is complete; initiate an autoreload.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
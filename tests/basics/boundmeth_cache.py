@@ -0,0 +1,42 @@
+# test that repeatedly fetched bound methods stay bound to the right object
+
+try:
+    import gc
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+class A:
+    def __init__(self, x):
+        self.x = x
+
+    def f(self):
+        return self.x
+
+    def g(self):
+        return -self.x
+
+
+objs = [A(i) for i in range(20)]
+meths = []
+for _ in range(3):
+    for o in objs:
+        meths.append(o.f)
+        meths.append(o.g)
+print(sum(m() for m in meths), len(set(meths)))
+print(objs[3].f == objs[3].f, objs[3].f == objs[4].f, objs[3].f == objs[3].g)
+
+# bound methods fetched before a collection still work after it
+m = objs[5].f
+del objs
+gc.collect()
+print(m(), A(7).f(), getattr(A(8), "g")())
+
+# methods of builtin objects
+l = []
+ap = l.append
+for i in range(3):
+    l.append(i)
+ap(3)
+print(l, [].append == [].append, l.append == l.append)
@@ -0,0 +1,41 @@
+# test that dicts keep their items in insertion order
+
+# small and larger dicts, with keys added, removed and added again
+for n in (3, 8, 9, 20, 300):
+    d = {}
+    for i in range(n):
+        d[str(i)] = i
+    for i in range(0, n, 3):
+        del d[str(i)]
+    d["0"] = -1
+    d[1] = "one"
+    print(n, len(d), list(d.items()) == [(str(i), i) for i in range(n) if i % 3] + [("0", -1), (1, "one")])
+
+# replacing a value keeps its position
+d = {"a": 1, "b": 2, "c": 3}
+d["a"] = 4
+print(d)
+
+# popitem removes the most recently added item
+d = {}
+for i in range(12):
+    d[i] = i * i
+del d[11]
+print(d.popitem(), d.popitem())
+d["x"] = "y"
+print(d.popitem(), list(d))
+while d:
+    d.popitem()
+d[5] = 5
+print(d)
+
+# copies and views keep the order
+d = {i * 7 % 10: i for i in range(10)}
+print(list(d), list(d.copy()), list(d.values()) == list(dict(d).values()))
+
+# unhashable keys raise even when the dict is small
+for f in (lambda: {1: 2}.get({}), lambda: {} in {1: 2}, lambda: {1: 2}[[]]):
+    try:
+        f()
+    except TypeError:
+        print("TypeError")
@@ -0,0 +1,56 @@
+# test multiplication and modular exponentiation of large ints
+
+try:
+    pow(3, 4, 7)
+except NotImplementedError:
+    print("SKIP")
+    raise SystemExit
+
+
+# a simple deterministic generator so the output doesn't depend on random
+def gen(bits, seed):
+    x = 0
+    for _ in range(bits // 16):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        x = (x << 16) | (seed >> 8) & 0xFFFF
+    return x
+
+
+# balanced, unbalanced and square products across a range of sizes
+for bits in (512, 1024, 1536, 2048, 3072, 4096, 8192, 20000):
+    a = gen(bits, bits)
+    b = gen(bits, bits + 1)
+    c = gen(bits // 3, bits + 2)
+    ab = a * b
+    print(bits, ab % 1000000007, (a * c) % 1000000007, (a * a) % 1000000007)
+    print(ab // b == a, (-a) * b == -ab, a * a == a**2, (a + b) * (a - b) == a * a - b * b)
+    print((a * c) // c == a, (c * a) % a == 0, a * a - 2 * ab + b * b == (a - b) ** 2)
+
+# powers of two and all-ones values have long runs of equal digits
+for bits in (1000, 3000, 5000):
+    ones = (1 << bits) - 1
+    print(ones * ones == (1 << 2 * bits) - (1 << bits + 1) + 1, ((1 << bits) * ones) >> bits == ones)
+
+# Mersenne primes, so that pow(x, p - 1, p) == 1
+for e in (521, 1279, 2203):
+    p = (1 << e) - 1
+    print(e, pow(3, p - 1, p), pow(gen(e, e), p - 1, p), pow(-gen(e + 100, e), p - 1, p))
+
+# odd moduli of RSA sizes, compared with repeated squaring
+for bits in (512, 1024, 2048):
+    m = gen(bits, 7 * bits) | 1 << bits - 1 | 1
+    x = gen(bits + 40, 3)
+    e = gen(64, bits)
+    r = 1
+    s = x % m
+    f = e
+    while f:
+        if f & 1:
+            r = r * s % m
+        s = s * s % m
+        f >>= 1
+    print(bits, pow(x, e, m) == r, pow(x, 65537, m) % 1000000007, pow(x, 1, m) == x % m)
+
+# even moduli
+m = gen(1024, 11) | 1 << 1023
+print(pow(gen(1000, 12), gen(300, 13), m) % 1000000007, pow(7, 1 << 100, 1 << 1024) % 1000000007)
@@ -0,0 +1,28 @@
+# test conversion of large ints to and from strings
+
+# powers of the base and their neighbours, around the sizes where conversion
+# switches from a digit at a time to splitting the number in two
+for n in (9, 10, 18, 19, 100, 299, 300, 301, 1000, 2000, 4000):
+    for v in (10**n - 1, 10**n, 10**n + 1, 7**n, -(3**n)):
+        s = str(v)
+        print(n, len(s), s[:12], s[-12:], int(s) == v)
+
+# other bases
+v = 3**5000
+for base in (2, 8, 16):
+    s = {2: bin, 8: oct, 16: hex}[base](v)
+    print(base, len(s), s[:12], s[-12:], int(s, 0) == v, int(s[2:], base) == v)
+s = "z" * 1000
+print(int(s, 36) == 36**1000 - 1, int(s.upper(), 36) == int(s, 36))
+
+# long runs of zeros in the middle and at the end
+for v in (10**1500 + 1, 7**700 * 10**700, 2**5000 + 2**10):
+    s = str(v)
+    print(len(s), s[:12], s[-12:], int(s) == v)
+
+# leading zeros and digits in groups of three
+print(int("0" * 3000 + "123456789" * 100) == int("123456789" * 100))
+for n in (20, 21, 22, 300, 301, 302):
+    s = "{:,}".format(10**n)
+    print(n, len(s), s[:8], s[-8:], int(s.replace(",", "")) == 10**n)
+print("{:,}".format(-(10**29)), "{:,}".format(123456789012345678901234567890))
@@ -0,0 +1,75 @@
+# test that sorting is stable and handles runs that are already in order
+
+
+# a simple deterministic generator so the output doesn't depend on random
+def gen(n, seed, mod):
+    l = []
+    for _ in range(n):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        l.append((seed >> 8) % mod)
+    return l
+
+
+# equal keys keep their original order, also when reversed
+l = [(k, i) for i, k in enumerate(gen(500, 1, 10))]
+for rev in (False, True):
+    s = sorted(l, key=lambda p: p[0], reverse=rev)
+    print(s[:5], s[-5:])
+    print(all(s[i][1] < s[i + 1][1] for i in range(len(s) - 1) if s[i][0] == s[i + 1][0]))
+
+# words sorted by length keep their order
+words = ["pear", "fig", "apple", "kiwi", "date", "plum", "lime", "banana", "cherry", "nut"]
+print(sorted(words, key=len))
+print(sorted(words, key=len, reverse=True))
+
+# ascending and descending runs, with and without duplicates
+for l in (
+    list(range(1000)),
+    list(range(1000, 0, -1)),
+    list(range(300)) + list(range(300, 0, -1)) + list(range(300)),
+    [i // 3 for i in range(900)] + [i // 3 for i in range(900, 0, -1)],
+    gen(2000, 2, 1 << 20),
+):
+    s = sorted(l)
+    print(len(s), s[0], s[-1], all(s[i] <= s[i + 1] for i in range(len(s) - 1)))
+    l.sort(reverse=True)
+    print(all(l[i] >= l[i + 1] for i in range(len(l) - 1)))
+
+# mixed int and float, and str
+print(sorted([3, 1.5, 2, 0.5, 2.0, 1]))
+print(sorted(["b", "ab", "a", "", "ba", "aa"]))
+
+# the key function is called once per item
+calls = 0
+
+
+def key(x):
+    global calls
+    calls += 1
+    return -x
+
+
+sorted(gen(100, 3, 50), key=key)
+print(calls)
+
+# a comparison that raises leaves all of the items in the list
+class A:
+    count = 0
+
+    def __init__(self, x):
+        self.x = x
+
+    def __lt__(self, other):
+        A.count += 1
+        if A.count == 3000:
+            raise ValueError
+        return self.x < other.x
+
+
+l = [A(x) for x in gen(1000, 4, 1000)]
+before = sorted(a.x for a in l)
+try:
+    l.sort()
+except ValueError:
+    print("ValueError")
+print(sorted(a.x for a in l) == before)
@@ -0,0 +1,16 @@
+# test searching long strings, which may use a different algorithm than short ones
+
+s = "abcab" * 30 + "needle in a haystack" + "cabba" * 30
+for t in (s, bytes(s, "ascii")):
+    needle = t[150:170]
+    print(t.find(needle), t.rfind(needle), t.index(needle), t.rindex(needle))
+    print(t.find(needle[:5]), t.rfind(needle[:5]), t.find(needle, 151), t.rfind(needle, 0, 169))
+    print(t.find(t[:4]), t.rfind(t[:4]), t.find(t[-4:]), t.rfind(t[-4:]))
+    print(t.count(t[:5]), t.count(t[-5:]), needle in t, needle + t[:1] in t)
+    print(len(t.split(t[:5])), t.rsplit(t[-5:], 2)[0][-20:], t.partition(needle)[2][:10])
+    print(t.replace(t[:5], t[:1])[:40], t.replace(t[-5:], t[:1], 3)[-40:])
+
+# needles longer than the largest skip
+s = "x" * 300 + "y" + "x" * 300
+for t in (s, bytes(s, "ascii")):
+    print(t.find(t[1:302]), t.rfind(t[299:600]), t.find(t[:299] + t[:1] * 3), t.count(t[:280]))
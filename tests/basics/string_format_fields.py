@@ -0,0 +1,22 @@
+# test str.format and % with several fields of each kind in one template
+
+# fields with no format spec print their argument in place
+print("{}|{!r}|{!s}|{}".format(1, "a", [2], None))
+print(f"{1 + 1}{'x'!r}{[3]}text{(4,)}")
+
+# format specs, short and long, with and without nested fields
+print("{:>5}|{:<5}|{:^5}|{:05d}".format("a", "b", "c", 42))
+print("{:*>30}|{:.{}f}".format("x", 3.2, 1))
+print(("{:" + "0" * 28 + "10}").format(7))
+print("{!r:>6}|{!s:<6}|".format("q", 5))
+
+# padded and truncated %s and %r share one buffer
+print("%5s|%-5r|%.2s|%*s|%.*r" % ("ab", "cd", "efgh", 4, 12, 3, [1, 2]))
+print("%r %s %5r %5s" % (1.5, b"b", None, ("t",)))
+print(b"%s|%5s|%r" % (b"x", b"y", b"z"))
+print("%s and %s" % ("no", "padding"), "%d%%" % 50)
+
+# join of a single item
+s = "abc" * 5
+print("".join([s]) is s, ",".join([s]) == s, b"".join([b"xy"]))
+print(repr("-".join([])), "-".join(["a"]), "-".join(("a", "b")))
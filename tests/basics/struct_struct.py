@@ -0,0 +1,48 @@
+# test struct.Struct and struct.iter_unpack
+
+try:
+    import struct
+    struct.Struct
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+s = struct.Struct("<hxI2s")
+print(s.format, s.size)
+b = s.pack(-2, 100000, b"abc")
+print(b, b == struct.pack("<hxI2s", -2, 100000, b"abc"))
+print(s.unpack(b))
+
+buf = bytearray(16)
+s.pack_into(buf, 2, 1, 2, b"z")
+print(buf)
+print(s.unpack_from(buf, 2), s.unpack_from(buf, offset=-9))
+
+# native alignment and repeat counts
+s = struct.Struct("b3Hq0s")
+print(s.size == struct.calcsize("b3Hq0s"), s.unpack(s.pack(1, 2, 3, 4, 5, b"")))
+
+# iterating over equally sized chunks
+data = struct.pack(">4H", 1, 2, 3, 4)
+print(list(struct.iter_unpack(">HH", data)))
+print(list(struct.Struct(">H").iter_unpack(data)))
+print(list(struct.iter_unpack("B", b"")))
+
+# errors
+for args in ((1,), (1, 2, b"", 3)):
+    try:
+        struct.Struct("<hxI2s").pack(*args)
+    except Exception:
+        print("pack error", len(args))
+try:
+    struct.Struct(">HH").unpack(b"123")
+except Exception:
+    print("unpack error")
+try:
+    struct.iter_unpack(">HH", b"123")
+except Exception:
+    print("iter_unpack error")
+try:
+    struct.Struct("3")
+except Exception:
+    print("format error")
@@ -0,0 +1,34 @@
+import arraytools
+from array import array
+
+a = array("h", [1000, -2000, 30000, -30000, 5])
+b = array("h", [1, 2, 3000, -3000, -5])
+d = array("h", bytes(10))
+
+# results saturate at the limits of the destination type
+print(list(arraytools.add(d, a, b)))
+print(list(arraytools.sub(d, a, b)))
+print(list(arraytools.mul(d, a, 2)))
+print(list(arraytools.mul(d, a, 0.5)))
+print(list(arraytools.clamp(d, a, -1000, 1000)))
+
+# in place, across chunk boundaries
+big = array("i", range(100))
+print(arraytools.add(big, big, 1) is big, list(big[:3]), list(big[97:]))
+
+# conversions between element types
+f = array("f", [1.5, -2.75, 1e6, -1e6, float("nan")])
+print(list(arraytools.convert(d, f)))
+print(list(arraytools.convert(bytearray(5), a)))
+print(list(arraytools.convert(array("f", [0] * 5), a)))
+print(list(arraytools.mul(array("I", [0]), array("I", [4000000000]), array("I", [4000000000]))))
+
+for args in ((d, a, b"12"), (d, b"12", a)):
+    try:
+        arraytools.add(*args)
+    except ValueError as e:
+        print("ValueError", e)
+try:
+    arraytools.convert(d, array("Q", [0] * 5))
+except ValueError as e:
+    print("ValueError", e)
@@ -0,0 +1,21 @@
+import arraytools
+from array import array
+
+a = array("h", [1000, -2000, 30000, -30000, 5])
+print(arraytools.min(a), arraytools.max(a), arraytools.sum(a), arraytools.mean(a))
+
+f = array("f", [1.5, -2.75, 1e6, -1e6])
+print(arraytools.min(f), arraytools.max(f), arraytools.sum(f), arraytools.mean(f))
+
+print(arraytools.sum(b""), arraytools.sum(bytearray(b"\xff" * 100)))
+print(arraytools.sum(memoryview(array("i", range(1000)))[10:20]))
+print(arraytools.sum(array("q", [2**62, -(2**62), 5])), arraytools.max(array("I", [4000000000])))
+
+try:
+    arraytools.min(b"")
+except ValueError as e:
+    print("ValueError", e)
+try:
+    arraytools.sum(array("q", [2**62, 2**62]))
+except OverflowError:
+    print("OverflowError")
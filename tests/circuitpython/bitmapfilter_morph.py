@@ -39,3 +39,14 @@ dump_bitmap(b)
 b = make_circle_bitmap()
 bitmapfilter.morph(b, weights=sharpen, threshold=True, add=0.125, invert=True)
 dump_bitmap(b)
+
+# Box and larger separable kernels are applied as two 1-D passes
+box = [1] * 25
+b = make_circle_bitmap()
+bitmapfilter.morph(b, weights=box, mask=q)
+dump_bitmap(b)
+
+gauss5 = [a * c for a in (1, 4, 6, 4, 1) for c in (1, 4, 6, 4, 1)]
+b = make_circle_bitmap()
+bitmapfilter.morph(b, weights=gauss5)
+dump_bitmap(b)
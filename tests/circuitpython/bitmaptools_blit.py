@@ -0,0 +1,96 @@
+# Check bitmaptools.blit against a per-pixel reference across depths, alignments and skip indices
+import displayio
+import bitmaptools
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def random_bitmap(w, h, depth):
+    bmp = displayio.Bitmap(w, h, 1 << depth)
+    for j in range(h):
+        for i in range(w):
+            bmp[i, j] = rand(1 << depth)
+    return bmp
+
+
+def copy(bmp):
+    out = displayio.Bitmap(bmp.width, bmp.height, 1 << bmp.bits_per_value)
+    for j in range(bmp.height):
+        for i in range(bmp.width):
+            out[i, j] = bmp[i, j]
+    return out
+
+
+def reference(dest, src, x, y, x1, y1, x2, y2, skip_source, skip_dest):
+    mask = (1 << dest.bits_per_value) - 1
+    for j in range(y1, y2):
+        for i in range(x1, x2):
+            xd = x + i - x1
+            yd = y + j - y1
+            if xd >= dest.width or yd >= dest.height:
+                continue
+            value = src[i, j]
+            if skip_source is not None and value == skip_source:
+                continue
+            if skip_dest is not None and dest[xd, yd] == skip_dest:
+                continue
+            dest[xd, yd] = value & mask
+
+
+def same(a, b):
+    for j in range(a.height):
+        for i in range(a.width):
+            if a[i, j] != b[i, j]:
+                return False
+    return True
+
+
+for dest_depth in (1, 2, 4, 8, 16):
+    for src_depth in (1, 2, 4, 8, 16):
+        if src_depth > dest_depth:
+            continue
+        ok = True
+        for trial in range(6):
+            src = random_bitmap(13 + rand(20), 5 + rand(4), src_depth)
+            dest = random_bitmap(11 + rand(30), 5 + rand(4), dest_depth)
+            x = rand(dest.width)
+            y = rand(dest.height)
+            x1 = rand(src.width)
+            y1 = rand(src.height)
+            x2 = x1 + rand(src.width - x1 + 1)
+            y2 = y1 + rand(src.height - y1 + 1)
+            skip_source = (None, 0, 1)[trial % 3]
+            skip_dest = (None, None, 0, 1)[trial % 4]
+            expected = copy(dest)
+            reference(expected, src, x, y, x1, y1, x2, y2, skip_source, skip_dest)
+            bitmaptools.blit(
+                dest,
+                src,
+                x,
+                y,
+                x1=x1,
+                y1=y1,
+                x2=x2,
+                y2=y2,
+                skip_source_index=skip_source,
+                skip_dest_index=skip_dest,
+            )
+            ok = ok and same(dest, expected)
+        print(dest_depth, src_depth, ok)
+
+# blitting a bitmap onto itself, in every direction
+for depth in (1, 4, 8, 16):
+    ok = True
+    for dx, dy in ((3, 0), (-3, 0), (0, 2), (0, -2), (9, 1), (-9, -1)):
+        bmp = random_bitmap(24, 8, depth)
+        expected = copy(bmp)
+        reference(expected, copy(bmp), max(dx, 0), max(dy, 0), max(-dx, 0), max(-dy, 0), 24, 8, None, None)
+        bitmaptools.blit(bmp, bmp, max(dx, 0), max(dy, 0), x1=max(-dx, 0), y1=max(-dy, 0))
+        ok = ok and same(bmp, expected)
+    print("self", depth, ok)
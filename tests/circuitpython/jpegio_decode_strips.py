@@ -0,0 +1,58 @@
+from displayio import Bitmap, Colorspace
+import bitmaptools
+from blinka_image import content, decoder
+
+
+def decode_full(source, scale, **kwargs):
+    w, h = decoder.open(source)
+    b = Bitmap(w >> scale, h >> scale, 65535 if kwargs.get("colorspace") != Colorspace.L8 else 256)
+    decoder.decode(b, scale=scale, **kwargs)
+    return b
+
+
+def test_strips(scale, strip_height):
+    full = decode_full(content, scale)
+    w, h = decoder.open(content)
+    strip = Bitmap(w >> scale, strip_height, 65535)
+    assembled = Bitmap(w >> scale, h >> scale, 65535)
+    calls = []
+
+    def callback(y, height):
+        calls.append((y, height))
+        bitmaptools.blit(assembled, strip, 0, y, x1=0, y1=0, x2=strip.width, y2=height)
+
+    decoder.decode_strips(strip, callback, scale)
+    print(scale, strip_height, calls)
+    print(memoryview(assembled) == memoryview(full))
+
+
+print("strips")
+test_strips(0, 16)
+test_strips(0, 40)
+test_strips(2, 4)
+test_strips(3, 7)
+
+print("colorspaces")
+swapped = decode_full(content, 3)
+for colorspace in (Colorspace.RGB565, Colorspace.BGR565, Colorspace.BGR565_SWAPPED, Colorspace.L8):
+    b = decode_full(content, 3, colorspace=colorspace)
+    print(colorspace, [hex(b[x, 15]) for x in range(0, 30, 6)])
+
+rgb565 = decode_full(content, 3, colorspace=Colorspace.RGB565)
+print(
+    all(
+        rgb565[i] == ((swapped[i] >> 8) | (swapped[i] & 0xFF) << 8) for i in range(swapped.width * swapped.height)
+    )
+)
+
+print("errors")
+decoder.open(content)
+try:
+    decoder.decode_strips(Bitmap(30, 4, 65535), print, 0)
+except ValueError as e:
+    print("ValueError")
+decoder.open(content)
+try:
+    decoder.decode(Bitmap(30, 30, 65535), colorspace=Colorspace.RGB888)
+except ValueError as e:
+    print(e)
@@ -0,0 +1,133 @@
+import adafruit_pixelbuf
+import random
+from rainbowio import colorwheel
+
+
+class PixelBuf(adafruit_pixelbuf.PixelBuf):
+    def _transmit(self, buf):
+        print("transmit", bytes(buf).hex())
+
+
+def try_call(f, *args):
+    try:
+        f(*args)
+    except (TypeError, ValueError) as e:
+        print(type(e).__name__, e)
+
+
+# gradients, in the buffer's byte order and with brightness applied on output
+p = PixelBuf(5, byteorder="GRB", auto_write=False)
+p.fill_gradient((0, 0, 0), (200, 100, 40))
+print(p[:])
+p.fill(0)
+p.fill_gradient(0xFF0000, 0x0000FF, 1, 4)
+print(p[:])
+p.fill_gradient(0x123456, 0x123456, 2, 3)
+print(p[:])
+try_call(p.fill_gradient, 0, 0, 3, 2)
+try_call(p.fill_gradient, 0, 0, 0, 6)
+
+p = PixelBuf(3, byteorder="RGBW", brightness=0.5, auto_write=True)
+p.fill_gradient((10, 20, 30, 0), (30, 20, 10, 200))
+
+p = PixelBuf(3, byteorder="BGR", auto_write=False)
+p.fill_gradient(0x808080, 0x000000)
+p.show()
+
+p = PixelBuf(3, byteorder="PBGR", auto_write=False)
+p.fill_gradient((0, 0, 0, 0.0), (100, 100, 100, 1.0))
+print(p[:])
+p.show()
+
+# palettes repeat along the strip and cycle with the offset
+p = PixelBuf(7, byteorder="GRB", auto_write=False)
+palette = b"\x01\x02\x03\x04\x05\x06\x07\x08\x09"
+p.fill_palette(palette)
+print(p[:])
+p.fill_palette(palette, 1)
+print(p[:])
+p.fill_palette(palette, -1)
+print(p[:])
+p.fill_palette(b"\xff\x00\x00\x00\x00\xff\x00\x00", 5, format="RGBX")
+print(p[:])
+# more entries than are converted up front
+big = bytes(i for i in range(60))
+p.fill_palette(big, 18, format="RGB")
+print(p[:])
+try_call(p.fill_palette, b"")
+try_call(p.fill_palette, b"\x01\x02")
+
+p = PixelBuf(4, byteorder="PBGR", brightness=0.5, auto_write=False)
+p.fill_palette(bytes([0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00]), format="RGB")
+print(p[:])
+p.show()
+
+# rainbows match rainbowio.colorwheel
+p = PixelBuf(8, byteorder="RGB", auto_write=False)
+for offset, repeat in ((0, 1), (10, 1), (-10, 2), (300.5, 0.5), (0, 0)):
+    p.fill_rainbow(offset, repeat)
+    o = offset % 256
+    step = 256 * repeat / len(p)
+    expected = [colorwheel(o + i * step) for i in range(len(p))]
+    print(offset, repeat, [(r << 16) | (g << 8) | b for r, g, b in p[:]] == expected)
+try_call(p.fill_rainbow, 0, -1)
+
+p = PixelBuf(3, byteorder="PRGB", auto_write=False)
+p.fill_rainbow()
+print(p[:])
+
+# fading scales colors and white but not DotStar brightness
+p = PixelBuf(2, byteorder="GRBW", auto_write=False)
+p[:] = ((200, 100, 50, 20), (255, 255, 255, 255))
+p.fade(0.5)
+print(p[:])
+p.fade(1)
+print(p[:])
+p.fade(0)
+print(p[:])
+try_call(p.fade, 1.5)
+
+p = PixelBuf(2, byteorder="PBGR", brightness=0.5, auto_write=False)
+p[:] = ((200, 100, 50, 0.5), (10, 20, 30, 1.0))
+p.fade(0.25)
+print(p[:])
+p.show()
+
+# blending between two frames, with either source being the destination
+a = PixelBuf(3, byteorder="RGB", auto_write=False)
+b = PixelBuf(3, byteorder="RGB", auto_write=False)
+a.fill(0x000000)
+b[:] = (0xFF0000, 0x00FF00, 0x0000FF)
+p = PixelBuf(3, byteorder="RGB", brightness=0.5, auto_write=False)
+for amount in (0, 0.25, 0.5, 1):
+    p.blend(a, b, amount)
+    print(amount, p[:])
+p.show()
+a.blend(a, b, 0.5)
+print(a[:])
+b.blend(a, b, 0.5)
+print(b[:])
+try_call(p.blend, a, 0, 0.5)
+try_call(p.blend, a, PixelBuf(4, byteorder="RGB"), 0.5)
+try_call(p.blend, a, PixelBuf(3, byteorder="GRB"), 0.5)
+try_call(p.blend, a, b, 2)
+
+d = PixelBuf(2, byteorder="PBGR", auto_write=False)
+e = PixelBuf(2, byteorder="PBGR", auto_write=False)
+d[:] = ((0, 0, 0, 0.0), (100, 0, 0, 1.0))
+e[:] = ((200, 100, 0, 1.0), (100, 0, 0, 0.0))
+d.blend(d, e, 0.5)
+print(d[:])
+
+# sparkles light up to count pixels with the color
+random.seed(1)
+p = PixelBuf(10, byteorder="GRB", auto_write=False)
+p.sparkle(0x102030, 4)
+lit = [c for c in p[:] if c != (0, 0, 0)]
+print(1 <= len(lit) <= 4, set(lit))
+p.fill(0)
+p.sparkle(0x102030, 0)
+print(p[:] == ((0, 0, 0),) * 10)
+p.sparkle(0x405060)
+print(sum(c == (0x40, 0x50, 0x60) for c in p[:]))
+try_call(p.sparkle, 0, -1)
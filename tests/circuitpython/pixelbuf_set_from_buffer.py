@@ -0,0 +1,61 @@
+import adafruit_pixelbuf
+import displayio
+
+
+class PixelBuf(adafruit_pixelbuf.PixelBuf):
+    def _transmit(self, buf):
+        print("transmit", bytes(buf).hex())
+
+
+# copied as is in the default byteorder, and reordered from other ones
+p = PixelBuf(3, byteorder="GRB", auto_write=False)
+p.set_from_buffer(b"\x01\x02\x03\x04\x05\x06")
+print(p[:])
+p.set_from_buffer(b"\x01\x02\x03\x04\x05\x06\x07\x08\x09", "RGB")
+print(p[:])
+p.set_from_buffer(b"\x01\x02\x03\xff\x04\x05\x06\xff", "RGBX")
+print(p[:])
+p.set_from_buffer(bytes([0x00, 0xF8, 0xE0, 0x07, 0x1F, 0x00]), "RGB565")
+print(p[:])
+p.show()
+
+for buf, fmt in ((b"\x01\x02", "RGB"), (bytes(12), "RGB"), (b"", "RGZ")):
+    try:
+        p.set_from_buffer(buf, fmt)
+    except ValueError as e:
+        print("ValueError", e)
+
+# no white is derived from RGB data and brightness is applied to the output
+p = PixelBuf(2, byteorder="GRBW", brightness=0.5, auto_write=True)
+p.set_from_buffer(b"\x10\x20\x30\x40\x50\x60", "RGB")
+print(p[:])
+p.set_from_buffer(b"\x10\x20\x30\x40\x50\x60\x70\x80")
+print(p[:])
+
+# RGB data sets the full DotStar brightness
+p = PixelBuf(2, byteorder="PBGR", auto_write=False)
+p[1] = (1, 2, 3, 0.5)
+p.set_from_buffer(b"\x10\x20\x30\x40\x50\x60", "RGB")
+print(p[:])
+p.show()
+
+# Bitmap rows are padded to whole words; the padding is skipped
+p = PixelBuf(6, byteorder="RGB", auto_write=False)
+b = displayio.Bitmap(5, 1, 65536)
+for x in range(5):
+    b[x, 0] = 0xF800 >> (2 * x)
+p.set_from_buffer(b, "RGB565")
+print(p[:])
+
+p.fill(0)
+b = displayio.Bitmap(3, 2, 65536)
+for i in range(6):
+    b[i % 3, i // 3] = 0x0001 << (2 * i)
+p.set_from_buffer(b, "RGB565")
+print(p[:])
+
+for b in (displayio.Bitmap(3, 2, 256), displayio.Bitmap(4, 2, 65536)):
+    try:
+        p.set_from_buffer(b, "RGB565")
+    except ValueError as e:
+        print("ValueError", e)
@@ -0,0 +1,24 @@
+# struct.Struct.unpack_into stores values in an existing list
+import struct
+
+s = struct.Struct("<HxB3s")
+out = [None] * 3
+s.unpack_into(out, b"\x01\x02\x00\x03abc")
+print(out)
+s.unpack_into(out, b"..\x04\x05\x00\x06xyz", 2)
+print(out)
+s.unpack_into(buffer=b"\x07\x00\x00\x08def", items=out)
+print(out)
+
+try:
+    s.unpack_into([0, 0], b"\x01\x02\x00\x03abc")
+except ValueError as e:
+    print("ValueError", e)
+try:
+    s.unpack_into((0, 0, 0), b"\x01\x02\x00\x03abc")
+except TypeError as e:
+    print("TypeError")
+try:
+    s.unpack_into(out, b"\x01\x02\x00\x03ab")
+except RuntimeError as e:
+    print("RuntimeError", e)
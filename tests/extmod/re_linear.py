@@ -0,0 +1,23 @@
+# patterns that take exponential time with a plain backtracking matcher
+
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+print(re.match("(x+x+)+y", "x" * 40))
+print(re.match("(x+x+)+y", "x" * 40 + "y").span())
+print(re.search("(a|aa)*[c]", "a" * 60))
+print(re.search("(a|aa)*[c]", "a" * 60 + "c").span())
+print(re.match("(.*)*[b]", "a" * 50))
+
+# captures are the same as when backtracking
+m = re.match("((a+)(a+))+(b)", "a" * 30 + "b")
+print(m.groups())
+m = re.search("(x*)(x+?)(x*)z", "x" * 40 + "z")
+print(m.span(1), m.span(2), m.span(3))
+
+# long subjects
+print(re.search("([a-z]+) ([0-9]+)!", "ab " * 200 + "end 42!").groups())
+print(len(re.compile("[a-z]+").sub("w", "abc " * 500)))
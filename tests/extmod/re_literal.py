@@ -0,0 +1,39 @@
+# test patterns containing literals, which are used to skip ahead in subjects
+
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# literal prefix
+r = re.compile("abc")
+print(r.search("xxabxabcabc").span())
+print(r.search("xxabxab"))
+print(r.match("abcd").span(), r.match("xabc"), r.match("ab"))
+print(re.search("(ab)c+d", "abcabccd").span())
+print(re.search("^abc", "xabc"), re.search("^abc", "abcx").span())
+print(re.search("x?abc", "xxabc").span())
+
+# literal in the middle or at the end
+print(re.search("\\d+ERROR", "12 ERROR 34ERROR").span())
+print(re.search("[a-z]+ing", "sing ring").span())
+print(re.search("[a-z]+ing", "sin rin"))
+print(re.search("a+b$", "aab aab").span())
+
+# no required literal
+print(re.search("ab|cd", "xxcd").span())
+print(re.search("a(b|c)d", "xxacdabd").span())
+print(re.search("(abc)?d", "abd").span())
+print(re.search("a*b?c", "xc").span())
+
+# sub and split skip over text without the literal
+print(re.sub("ab", "-", "xabyabzab"))
+print(re.sub("a(b+)", "\\1", "ab abb abbb"))
+print(re.compile("--").split("a--b--c"))
+
+# module-level functions with more patterns than are cached
+for i in range(20):
+    print(re.match("p%d" % (i % 12), "p%d" % (i % 5)) is not None, end=" ")
+print()
+print(re.match("p3", "p3").span(), re.match(b"p3", b"p3").span())
@@ -1,10 +1,11 @@
+# a nested repeat that matches the empty string used to exhaust the stack
+# when backtracking; the Pike VM handles it without deep recursion
+
 try:
     import re
 except ImportError:
     print("SKIP")
     raise SystemExit
 
-try:
-    re.match("(a*)*", "aaa")
-except RuntimeError:
-    print("RuntimeError")
+print(re.match("(a*)*", "aaa").group(0))
+print(re.match("(a*)*b", "aaab").group(0))
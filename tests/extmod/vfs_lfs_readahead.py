@@ -0,0 +1,88 @@
+# CIRCUITPY-CHANGE: micropython does not have this file
+# Test VfsLfs cachesize/readahead tunables and block device stats
+import os
+
+try:
+    os.VfsLfs1
+    os.VfsLfs2
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 1024
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+def read_file(fs):
+    with fs.open("data", "rb") as f:
+        while f.read(16):
+            pass
+
+
+def test(vfs_class):
+    print("test", vfs_class)
+
+    bdev = RAMBlockDevice(30)
+    vfs_class.mkfs(bdev)
+
+    # stats start at zero and count device operations
+    fs = vfs_class(bdev, readsize=16, progsize=16)
+    print(fs.stats()[1:])
+    with fs.open("data", "wb") as f:
+        for i in range(100):
+            f.write(bytes(range(i, i + 20)))
+    reads, progs, erases = fs.stats()
+    print(progs > 0, erases > 0)
+
+    # reading the file back without readahead
+    fs = vfs_class(bdev, readsize=16, progsize=16)
+    read_file(fs)
+    plain_reads = fs.stats()[0]
+
+    # and with readahead, which needs fewer device reads; littlefs v1 has no cachesize
+    cache = {"cachesize": 64} if vfs_class is os.VfsLfs2 else {}
+    fs = vfs_class(bdev, readsize=16, progsize=16, readahead=256, **cache)
+    read_file(fs)
+    print(fs.stats()[0] < plain_reads)
+
+    # data read through the readahead window is correct
+    with fs.open("data", "rb") as f:
+        data = f.read()
+    print(len(data), data == b"".join(bytes(range(i, i + 20)) for i in range(100)))
+
+    # writes invalidate the readahead window
+    with fs.open("data", "wb") as f:
+        f.write(b"new contents")
+    with fs.open("data", "rb") as f:
+        print(f.read())
+
+    # invalid tunables
+    for kw in ({"readahead": 24}, {"readahead": 2048}, {"cachesize": 24}, {"cachesize": 64}):
+        try:
+            vfs_class(bdev, readsize=16, progsize=16, **kw)
+        except ValueError:
+            print("ValueError", kw)
+
+
+test(os.VfsLfs1)
+test(os.VfsLfs2)
@@ -0,0 +1,35 @@
+# Test readline() on a file with lines longer than a single read chunk,
+# interleaved with other reads and seeks.
+
+f = open("data/bigfile1", "rb")
+lines = [f.readline() for _ in range(5)]
+print(lines)
+print(f.tell())
+print(f.read(10))
+print(f.readline(3))
+print(f.readline(200))
+print(f.tell())
+f.seek(0)
+print(len(f.readlines()))
+print(f.readline())
+f.close()
+
+# readall after readline
+f = open("data/bigfile1", "rb")
+f.readline()
+data = f.read()
+print(len(data), data[-10:])
+f.close()
+
+# text mode
+f = open("data/bigfile1")
+n = 0
+for line in f:
+    n += len(line)
+print(n)
+f.close()
+
+# final line without trailing newline
+f = open("data/file1", "rb")
+print(f.readlines())
+f.close()
@@ -0,0 +1,49 @@
+# This tests big integer modular exponentiation, as used by RSA and Diffie-Hellman.
+
+
+def gen_int(bits, seed):
+    # A simple deterministic generator so that all targets use the same numbers.
+    x = 0
+    for _ in range(bits // 16):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        x = (x << 16) | (seed >> 8) & 0xFFFF
+    return x | 1 << (bits - 1)
+
+
+def test(nloop, bits):
+    # An odd modulus with the top bit set, like an RSA modulus or a safe prime.
+    mod = gen_int(bits, bits) | 1
+    base = gen_int(bits, 3) % mod
+    check = 0
+    for i in range(nloop):
+        # A full size private exponent and a small public one.
+        exp = gen_int(bits, i + 7)
+        x = pow(base, exp, mod)
+        y = pow(x, 65537, mod)
+        check ^= x ^ y
+    return check & 0xFFFFFFFF
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (1, 512),
+    (100, 100): (1, 1024),
+    (1000, 1000): (4, 1024),
+    (5000, 1000): (4, 2048),
+}
+
+
+def bm_setup(params):
+    nloop, bits = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nloop, bits)
+
+    def result():
+        return nloop, state
+
+    return run, result
@@ -0,0 +1,49 @@
+# Parse NMEA sentences with re, where greedy repeats run over long subjects
+
+try:
+    import re
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+LINES = (
+    "$GPGGA,123519.00,4807.038247,N,01131.000123,E,1,08,0.9,545.4,M,46.9,M,,,,,,,,,,,,,,,,,,,,,,,,,,,,*47",
+    "$GPRMC,123519.00,A,4807.038247,N,01131.000123,E,022.4,084.4,230394,003.1,W,A,,,,,,,,,,,,,,*6A",
+    "$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00,14,25,170,00,16,57,208,39*75",
+)
+
+
+def test(niter):
+    sentence = re.compile(r"\$GP(\w+),(.*)\*")
+    checksum = re.compile(r"\*([0-9A-F]+)$")
+    n = 0
+    for _ in range(niter):
+        for line in LINES:
+            m = sentence.match(line)
+            n += len(m.group(2)) + len(checksum.search(line).group(1))
+    return n
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 10): (5,),
+    (100, 10): (10,),
+    (1000, 10): (100,),
+    (5000, 10): (500,),
+}
+
+
+def bm_setup(params):
+    (niter,) = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(niter)
+
+    def result():
+        return niter, state
+
+    return run, result